@@ -32,9 +32,12 @@ func main() {
 	// Register all commands
 	rootCmd.AddCommand(cli.BuildCmd(client))
 	rootCmd.AddCommand(cli.RunCmd(client))
+	rootCmd.AddCommand(cli.WatchCmd(client))
 	rootCmd.AddCommand(cli.TestCmd(client))
+	rootCmd.AddCommand(cli.SanitizeCmd(client))
 	rootCmd.AddCommand(cli.BenchCmd(client))
 	rootCmd.AddCommand(cli.CleanCmd())
+	rootCmd.AddCommand(cli.CacheCmd())
 	rootCmd.AddCommand(cli.NewCmd(client))
 	rootCmd.AddCommand(cli.AddCmd(client, getBcrPath))
 	rootCmd.AddCommand(cli.RemoveCmd(client))
@@ -46,6 +49,7 @@ func main() {
 	rootCmd.AddCommand(cli.FlawfinderCmd())
 	rootCmd.AddCommand(cli.CppcheckCmd())
 	rootCmd.AddCommand(cli.AnalyzeCmd(client))
+	rootCmd.AddCommand(cli.PchCmd())
 
 	rootCmd.AddCommand(cli.DocCmd())
 	rootCmd.AddCommand(cli.ReleaseCmd())
@@ -6,6 +6,7 @@ import (
 	"net/http"
 	"os"
 	"strings"
+	"sync"
 
 	"github.com/ozacod/cpx/internal/pkg/bazel"
 	"github.com/ozacod/cpx/internal/pkg/vcpkg"
@@ -17,7 +18,7 @@ var addGetBcrPathFunc func() string
 
 // Mockable functions for bazel operations (for testing)
 var bazelGetLatestVersionFunc func(bcrPath, moduleName string) (string, error)
-var bazelAddDependencyFunc func(modulePath, depName, version string) error
+var bazelAddDependenciesFunc func(modulePath string, deps []bazel.Dependency) error
 
 func init() {
 	// Set default implementations
@@ -25,7 +26,7 @@ func init() {
 		client := bazel.NewClient(bcrPath)
 		return client.GetLatestVersion(moduleName)
 	}
-	bazelAddDependencyFunc = bazel.AddDependency
+	bazelAddDependenciesFunc = bazel.AddDependencies
 }
 
 // AddCmd creates the add command
@@ -36,12 +37,15 @@ func AddCmd(client *vcpkg.Client, getBcrPath func() string) *cobra.Command {
 	addGetBcrPathFunc = getBcrPath
 
 	cmd := &cobra.Command{
-		Use:   "add [package]",
-		Short: "Add a dependency",
-		Long: `Add a dependency to your project.
+		Use:   "add [packages...]",
+		Short: "Add one or more dependencies",
+		Long: `Add one or more dependencies to your project in a single batch.
 
 For vcpkg projects: passes through to 'vcpkg add port' and prints usage info.
-For Bazel projects: fetches the latest version from BCR and updates MODULE.bazel.`,
+For Bazel projects: fetches the latest versions from BCR and updates MODULE.bazel once.
+For Meson projects: installs WrapDB wraps, downloading independent wraps in parallel.`,
+		Example: `  cpx add fmt
+  cpx add fmt spdlog nlohmann-json`,
 		RunE: func(cmd *cobra.Command, args []string) error {
 			return runAdd(cmd, args, client)
 		},
@@ -89,9 +93,8 @@ func runVcpkgAdd(args []string, client *vcpkg.Client) error {
 		return err
 	}
 
-	// Print usage info for the first package
-	if len(args) > 0 {
-		pkgName := args[0]
+	// Print usage info for every added package
+	for _, pkgName := range args {
 		if !strings.HasPrefix(pkgName, "-") {
 			printVcpkgUsageInfo(pkgName)
 		}
@@ -106,6 +109,8 @@ func runBazelAdd(args []string) error {
 		return fmt.Errorf("bazel Central Registry not configured\n  hint: run 'cpx config set-bcr-root <path>' or reinstall cpx")
 	}
 
+	// Resolve all versions first, then write MODULE.bazel in one batch
+	var deps []bazel.Dependency
 	for _, pkgName := range args {
 		if strings.HasPrefix(pkgName, "-") {
 			continue
@@ -117,14 +122,21 @@ func runBazelAdd(args []string) error {
 			fmt.Printf("%s✗ Module '%s' not found in BCR%s\n", Red, pkgName, Reset)
 			continue
 		}
+		deps = append(deps, bazel.Dependency{Name: pkgName, Version: version})
+	}
 
-		// Add to MODULE.bazel (uses mockable function)
-		if err := bazelAddDependencyFunc("MODULE.bazel", pkgName, version); err != nil {
-			return fmt.Errorf("failed to add dependency: %w", err)
-		}
+	if len(deps) == 0 {
+		return nil
+	}
 
-		fmt.Printf("%s✓ Added %s@%s to MODULE.bazel%s\n", Green, pkgName, version, Reset)
-		printBazelUsageInfo(pkgName)
+	// Add to MODULE.bazel (uses mockable function)
+	if err := bazelAddDependenciesFunc("MODULE.bazel", deps); err != nil {
+		return fmt.Errorf("failed to add dependencies: %w", err)
+	}
+
+	for _, dep := range deps {
+		fmt.Printf("%s✓ Added %s@%s to MODULE.bazel%s\n", Green, dep.Name, dep.Version, Reset)
+		printBazelUsageInfo(dep.Name)
 	}
 
 	return nil
@@ -137,24 +149,52 @@ func runMesonAdd(args []string) error {
 		return fmt.Errorf("meson not found in PATH: %w", err)
 	}
 
+	var packages []string
 	for _, pkgName := range args {
-		if strings.HasPrefix(pkgName, "-") {
-			continue
+		if !strings.HasPrefix(pkgName, "-") {
+			packages = append(packages, pkgName)
 		}
+	}
+	if len(packages) == 0 {
+		return nil
+	}
 
-		fmt.Printf("%sInstalling wrap for %s...%s\n", Cyan, pkgName, Reset)
+	// Create subprojects dir if it doesn't exist (meson wrap install might need it)
+	if err := createDirIfNotExists("subprojects"); err != nil {
+		return fmt.Errorf("failed to create subprojects directory: %w", err)
+	}
 
-		// Create subprojects dir if it doesn't exist (meson wrap install might need it)
-		if err := createDirIfNotExists("subprojects"); err != nil {
-			return fmt.Errorf("failed to create subprojects directory: %w", err)
-		}
+	// Wrap downloads are independent, fetch them in parallel with prefixed
+	// logs so the interleaved output stays readable
+	if len(packages) > 1 {
+		fmt.Printf("%sInstalling %d wraps in parallel...%s\n", Cyan, len(packages), Reset)
+	} else {
+		fmt.Printf("%sInstalling wrap for %s...%s\n", Cyan, packages[0], Reset)
+	}
 
-		// Run: meson wrap install <pkgName>
-		cmd := execCommand("meson", "wrap", "install", pkgName)
-		cmd.Stdout = os.Stdout
-		cmd.Stderr = os.Stderr
+	var outputMu sync.Mutex
+	var wg sync.WaitGroup
+	installErrs := make([]error, len(packages))
+
+	for i, pkgName := range packages {
+		wg.Add(1)
+		go func(i int, pkgName string) {
+			defer wg.Done()
+
+			out := newPrefixWriter(&outputMu, os.Stdout, pkgName, prefixPalette[i%len(prefixPalette)])
+
+			// Run: meson wrap install <pkgName>
+			cmd := execCommand("meson", "wrap", "install", pkgName)
+			cmd.Stdout = out
+			cmd.Stderr = out
+			installErrs[i] = cmd.Run()
+			out.Flush()
+		}(i, pkgName)
+	}
+	wg.Wait()
 
-		if err := cmd.Run(); err != nil {
+	for i, pkgName := range packages {
+		if installErrs[i] != nil {
 			fmt.Printf("%s✗ Failed to install wrap for %s%s\n", Red, pkgName, Reset)
 			continue
 		}
@@ -5,6 +5,7 @@ import (
 	"os"
 	"testing"
 
+	"github.com/ozacod/cpx/internal/pkg/bazel"
 	"github.com/stretchr/testify/assert"
 	"github.com/stretchr/testify/require"
 )
@@ -112,11 +113,11 @@ func TestRunBazelAdd(t *testing.T) {
 			// Save and restore original functions
 			oldGetBcrPathFunc := addGetBcrPathFunc
 			oldGetLatestVersionFunc := bazelGetLatestVersionFunc
-			oldAddDependencyFunc := bazelAddDependencyFunc
+			oldAddDependenciesFunc := bazelAddDependenciesFunc
 			defer func() {
 				addGetBcrPathFunc = oldGetBcrPathFunc
 				bazelGetLatestVersionFunc = oldGetLatestVersionFunc
-				bazelAddDependencyFunc = oldAddDependencyFunc
+				bazelAddDependenciesFunc = oldAddDependenciesFunc
 			}()
 
 			// Setup the mock for getBcrPath
@@ -135,9 +136,9 @@ func TestRunBazelAdd(t *testing.T) {
 				return "", assert.AnError
 			}
 
-			// Setup the mock for AddDependency (uses the real implementation)
-			bazelAddDependencyFunc = func(modulePath, depName, version string) error {
-				// For testing, we'll use the real AddDependency since it just writes to a file
+			// Setup the mock for AddDependencies (uses the real implementation)
+			bazelAddDependenciesFunc = func(modulePath string, deps []bazel.Dependency) error {
+				// For testing, we'll use the real AddDependencies since it just writes to a file
 				return nil // Just succeed for test purposes
 			}
 
@@ -334,3 +335,88 @@ func TestPrintMesonUsageInfo(t *testing.T) {
 		})
 	}
 }
+
+func TestRunBazelAdd_BatchedManifestWrite(t *testing.T) {
+	oldGetBcrPathFunc := addGetBcrPathFunc
+	oldGetLatestVersionFunc := bazelGetLatestVersionFunc
+	oldAddDependenciesFunc := bazelAddDependenciesFunc
+	defer func() {
+		addGetBcrPathFunc = oldGetBcrPathFunc
+		bazelGetLatestVersionFunc = oldGetLatestVersionFunc
+		bazelAddDependenciesFunc = oldAddDependenciesFunc
+	}()
+
+	addGetBcrPathFunc = func() string { return "/test/bcr" }
+
+	versions := map[string]string{
+		"googletest": "1.14.0",
+		"abseil-cpp": "20240116.0",
+		"fmt":        "10.2.1",
+	}
+	bazelGetLatestVersionFunc = func(bcrPath, moduleName string) (string, error) {
+		if version, ok := versions[moduleName]; ok {
+			return version, nil
+		}
+		return "", assert.AnError
+	}
+
+	writeCalls := 0
+	var written []bazel.Dependency
+	bazelAddDependenciesFunc = func(modulePath string, deps []bazel.Dependency) error {
+		writeCalls++
+		written = deps
+		return nil
+	}
+
+	// Capture output
+	old := os.Stdout
+	r, w, _ := os.Pipe()
+	os.Stdout = w
+
+	runErr := runBazelAdd([]string{"googletest", "not-in-bcr", "abseil-cpp", "fmt"})
+
+	require.NoError(t, w.Close())
+	os.Stdout = old
+	var buf bytes.Buffer
+	_, err := buf.ReadFrom(r)
+	require.NoError(t, err)
+
+	assert.NoError(t, runErr)
+	// All resolvable modules land in MODULE.bazel with one write
+	assert.Equal(t, 1, writeCalls)
+	assert.Equal(t, []bazel.Dependency{
+		{Name: "googletest", Version: "1.14.0"},
+		{Name: "abseil-cpp", Version: "20240116.0"},
+		{Name: "fmt", Version: "10.2.1"},
+	}, written)
+	assert.Contains(t, buf.String(), "not-in-bcr")
+}
+
+func TestRunVcpkgAdd_MultiplePackagesSingleInvocation(t *testing.T) {
+	oldRunFunc := addRunVcpkgCommandFunc
+	defer func() { addRunVcpkgCommandFunc = oldRunFunc }()
+
+	var invocations [][]string
+	addRunVcpkgCommandFunc = func(args []string) error {
+		invocations = append(invocations, args)
+		return nil
+	}
+
+	// Capture output
+	old := os.Stdout
+	r, w, _ := os.Pipe()
+	os.Stdout = w
+
+	runErr := runVcpkgAdd([]string{"fmt", "spdlog", "nlohmann-json"}, nil)
+
+	require.NoError(t, w.Close())
+	os.Stdout = old
+	var buf bytes.Buffer
+	_, err := buf.ReadFrom(r)
+	require.NoError(t, err)
+
+	assert.NoError(t, runErr)
+	// One vcpkg round-trip resolves all packages
+	require.Len(t, invocations, 1)
+	assert.Equal(t, []string{"add", "port", "fmt", "spdlog", "nlohmann-json"}, invocations[0])
+}
@@ -11,7 +11,7 @@ func AnalyzeCmd(client *vcpkg.Client) *cobra.Command {
 	cmd := &cobra.Command{
 		Use:   "analyze",
 		Short: "Run comprehensive code analysis and generate HTML report",
-		Long:  "Run comprehensive code analysis using cppcheck, clang-tidy, and flawfinder. Generates a combined HTML report (analyze.html).",
+		Long:  "Run comprehensive code analysis using cppcheck, clang-tidy, and flawfinder. Generates a combined HTML report (analyze.html).\n\nWith --includes, also builds the header dependency graph from the compile database and reports the most expensive includes (pair with 'cpx build --time-trace' for per-header compile times).",
 		RunE: func(cmd *cobra.Command, args []string) error {
 			return runAnalyze(cmd, args, client)
 		},
@@ -22,6 +22,7 @@ func AnalyzeCmd(client *vcpkg.Client) *cobra.Command {
 	cmd.Flags().Bool("skip-cppcheck", false, "Skip Cppcheck analysis")
 	cmd.Flags().Bool("skip-lint", false, "Skip clang-tidy analysis")
 	cmd.Flags().Bool("skip-flawfinder", false, "Skip Flawfinder analysis")
+	cmd.Flags().Bool("includes", false, "Analyze the include graph: expensive headers and redundant includes")
 
 	return cmd
 }
@@ -31,6 +32,7 @@ func runAnalyze(cmd *cobra.Command, args []string, client *vcpkg.Client) error {
 	skipCppcheck, _ := cmd.Flags().GetBool("skip-cppcheck")
 	skipLint, _ := cmd.Flags().GetBool("skip-lint")
 	skipFlawfinder, _ := cmd.Flags().GetBool("skip-flawfinder")
+	includes, _ := cmd.Flags().GetBool("includes")
 
 	// Get remaining args as target directories (default to current directory)
 	targets := args
@@ -38,5 +40,5 @@ func runAnalyze(cmd *cobra.Command, args []string, client *vcpkg.Client) error {
 		targets = []string{"."}
 	}
 
-	return quality.RunComprehensiveAnalysis(output, skipCppcheck, skipLint, skipFlawfinder, targets, client)
+	return quality.RunComprehensiveAnalysis(output, skipCppcheck, skipLint, skipFlawfinder, includes, targets, client)
 }
@@ -19,6 +19,11 @@ func BenchCmd(client *vcpkg.Client) *cobra.Command {
 		Long:  "Build the project benchmarks and run them. Detects vcpkg/CMake or Bazel projects automatically.",
 		Example: `  cpx bench            # Build + run all benchmarks
   cpx bench --verbose  # Show verbose output
+  cpx bench --save main               # Record this run as baseline 'main'
+  cpx bench --compare main            # Fail if >5% slower than 'main'
+  cpx bench --compare main --threshold 10  # Custom regression threshold
+  cpx bench --profile                 # Capture a flamegraph (flamegraph.html)
+  cpx bench --profile hot.html        # Flamegraph with a custom output path
   cpx bench --target //bench:myapp_bench  # Run specific benchmark (Bazel)`,
 		RunE: func(cmd *cobra.Command, args []string) error {
 			return runBenchCmd(cmd, args, client)
@@ -27,6 +32,11 @@ func BenchCmd(client *vcpkg.Client) *cobra.Command {
 
 	cmd.Flags().BoolP("verbose", "v", false, "Show verbose build output")
 	cmd.Flags().String("target", "", "Specific benchmark target to run (Bazel projects)")
+	cmd.Flags().String("save", "", "Save this run as a named baseline in .cpx/bench-history")
+	cmd.Flags().String("compare", "", "Compare against a named baseline and fail on regressions")
+	cmd.Flags().Float64("threshold", 5.0, "Regression threshold in percent for --compare")
+	cmd.Flags().String("profile", "", "Run under perf and write an interactive flamegraph HTML")
+	cmd.Flags().Lookup("profile").NoOptDefVal = "flamegraph.html"
 
 	return cmd
 }
@@ -34,18 +44,34 @@ func BenchCmd(client *vcpkg.Client) *cobra.Command {
 func runBenchCmd(cmd *cobra.Command, args []string, client *vcpkg.Client) error {
 	verbose, _ := cmd.Flags().GetBool("verbose")
 	target, _ := cmd.Flags().GetString("target")
+	save, _ := cmd.Flags().GetString("save")
+	compare, _ := cmd.Flags().GetString("compare")
+	threshold, _ := cmd.Flags().GetFloat64("threshold")
+	profile, _ := cmd.Flags().GetString("profile")
 
 	// Detect project type
 	projectType := DetectProjectType()
 
 	switch projectType {
 	case ProjectTypeBazel:
+		if save != "" || compare != "" {
+			fmt.Printf("%sBenchmark history is currently only supported for CMake projects, ignoring --save/--compare%s\n", Yellow, Reset)
+		}
+		if profile != "" {
+			fmt.Printf("%sFlamegraph capture is currently only supported for CMake projects, ignoring --profile%s\n", Yellow, Reset)
+		}
 		return runBazelBench(verbose, target)
 	case ProjectTypeMeson:
+		if save != "" || compare != "" {
+			fmt.Printf("%sBenchmark history is currently only supported for CMake projects, ignoring --save/--compare%s\n", Yellow, Reset)
+		}
+		if profile != "" {
+			fmt.Printf("%sFlamegraph capture is currently only supported for CMake projects, ignoring --profile%s\n", Yellow, Reset)
+		}
 		return runMesonBench(verbose, target)
 	default:
 		// Fall back to CMake
-		return build.RunBenchmarks(verbose, client)
+		return build.RunBenchmarks(verbose, save, compare, threshold, profile, client)
 	}
 }
 
@@ -102,7 +128,7 @@ func runMesonBench(verbose bool, target string) error {
 
 	// Ensure builddir exists
 	if _, err := os.Stat("builddir"); os.IsNotExist(err) {
-		if err := runMesonBuild(false, "", false, verbose, "", ""); err != nil {
+		if err := runMesonBuild(false, "", false, verbose, "", "", false, "", "", false, false); err != nil {
 			return fmt.Errorf("build failed: %w", err)
 		}
 	}
@@ -23,8 +23,18 @@ func BuildCmd(client *vcpkg.Client) *cobra.Command {
   cpx build -O3          # Maximum optimization
   cpx build -j 8         # Use 8 parallel jobs
   cpx build --clean      # Clean rebuild
+  cpx build --unity      # Unity (jumbo) build
+  cpx build --lto        # Release build with ThinLTO
+  cpx build --lto=full   # Release build with full LTO
+  cpx build --pgo-gen    # Instrumented build for PGO training
+  cpx build --pgo-use    # Optimized rebuild from collected profiles
   cpx build --asan       # Build with AddressSanitizer
   cpx build --tsan       # Build with ThreadSanitizer
+  cpx build --linker     # Link with the fastest linker found (mold > lld)
+  cpx build --linker=mold # Link with mold explicitly
+  cpx build --time-trace # Profile compile time and write an HTML report
+  cpx build --stats      # Record per-target build times and show the slowest
+  cpx build --remote     # Distribute compilation across the build farm
   cpx build --watch      # Watch for changes and rebuild`,
 		RunE: func(cmd *cobra.Command, args []string) error {
 			return runBuild(cmd, args, client)
@@ -38,6 +48,16 @@ func BuildCmd(client *vcpkg.Client) *cobra.Command {
 	cmd.Flags().BoolP("clean", "c", false, "Clean build directory before building")
 	cmd.Flags().StringP("opt", "O", "", "Override optimization level: 0,1,2,3,s,fast")
 	cmd.Flags().BoolP("watch", "w", false, "Watch for file changes and rebuild automatically")
+	cmd.Flags().Bool("unity", false, "Unity (jumbo) build: batch source files per target")
+	cmd.Flags().String("lto", "", "Link-time optimization: thin or full")
+	cmd.Flags().Lookup("lto").NoOptDefVal = "thin"
+	cmd.Flags().String("linker", "", "Fast linker: mold, lld, or auto")
+	cmd.Flags().Lookup("linker").NoOptDefVal = "auto"
+	cmd.Flags().Bool("time-trace", false, "Profile compile time with -ftime-trace (clang) and report hotspots")
+	cmd.Flags().Bool("stats", false, "Record per-target build times into .cpx/build-stats and report the slowest targets")
+	cmd.Flags().Bool("remote", false, "Distribute compilation via distcc/icecream (Bazel: --config=remote)")
+	cmd.Flags().Bool("pgo-gen", false, "Instrumented build that collects PGO profiles in .cache/pgo")
+	cmd.Flags().Bool("pgo-use", false, "Rebuild optimized with the merged PGO profiles")
 	cmd.Flags().Bool("verbose", false, "Show full build output")
 	// Sanitizer flags
 	cmd.Flags().Bool("asan", false, "Build with AddressSanitizer")
@@ -56,6 +76,47 @@ func runBuild(cmd *cobra.Command, args []string, client *vcpkg.Client) error {
 	optLevel, _ := cmd.Flags().GetString("opt")
 	watch, _ := cmd.Flags().GetBool("watch")
 	verbose, _ := cmd.Flags().GetBool("verbose")
+	unity, _ := cmd.Flags().GetBool("unity")
+	lto, _ := cmd.Flags().GetString("lto")
+
+	if lto != "" && lto != "thin" && lto != "full" {
+		return fmt.Errorf("invalid --lto mode '%s' (expected thin or full)", lto)
+	}
+	// LTO on an unoptimized build is pointless; default to a release build
+	if lto != "" && !release && optLevel == "" {
+		release = true
+	}
+
+	// Resolve the fast linker up front so a missing mold/lld fails before
+	// any build system is invoked
+	linkerFlag, _ := cmd.Flags().GetString("linker")
+	linker, err := build.ResolveLinker(linkerFlag)
+	if err != nil {
+		return err
+	}
+	if linkerFlag == "auto" {
+		fmt.Printf("%sUsing %s linker%s\n", Cyan, linker, Reset)
+	}
+
+	timeTrace, _ := cmd.Flags().GetBool("time-trace")
+	stats, _ := cmd.Flags().GetBool("stats")
+	remote, _ := cmd.Flags().GetBool("remote")
+
+	pgoGen, _ := cmd.Flags().GetBool("pgo-gen")
+	pgoUse, _ := cmd.Flags().GetBool("pgo-use")
+	if pgoGen && pgoUse {
+		return fmt.Errorf("--pgo-gen and --pgo-use cannot be combined (instrument, train, then rebuild)")
+	}
+	pgo := ""
+	if pgoGen {
+		pgo = "gen"
+	} else if pgoUse {
+		pgo = "use"
+	}
+	// Profile both phases at the optimization level that will ship
+	if pgo != "" && !release && optLevel == "" {
+		release = true
+	}
 
 	// Parse sanitizer flags
 	asan, _ := cmd.Flags().GetBool("asan")
@@ -94,28 +155,46 @@ func runBuild(cmd *cobra.Command, args []string, client *vcpkg.Client) error {
 			fmt.Printf("%sWatch mode not yet supported for Bazel projects%s\n", Yellow, Reset)
 			return nil
 		}
-		return runBazelBuild(release, target, clean, verbose, optLevel, sanitizer)
+		if unity {
+			fmt.Printf("%sUnity builds are not supported for Bazel projects, ignoring --unity%s\n", Yellow, Reset)
+		}
+		if pgo != "" {
+			fmt.Printf("%sPGO builds are currently only supported for CMake projects, ignoring --pgo-%s%s\n", Yellow, pgo, Reset)
+		}
+		if timeTrace {
+			fmt.Printf("%sCompile-time profiling is currently only supported for CMake projects, ignoring --time-trace%s\n", Yellow, Reset)
+		}
+		if stats {
+			fmt.Printf("%sBuild stats need a Ninja log and are not supported for Bazel projects, ignoring --stats%s\n", Yellow, Reset)
+		}
+		return runBazelBuild(release, target, clean, verbose, optLevel, sanitizer, lto, linker, remote)
 	case ProjectTypeMeson:
 		if watch {
 			fmt.Printf("%sWatch mode not yet supported for Meson projects%s\n", Yellow, Reset)
 			return nil
 		}
-		return runMesonBuild(release, target, clean, verbose, optLevel, sanitizer)
+		if pgo != "" {
+			fmt.Printf("%sPGO builds are currently only supported for CMake projects, ignoring --pgo-%s%s\n", Yellow, pgo, Reset)
+		}
+		if timeTrace {
+			fmt.Printf("%sCompile-time profiling is currently only supported for CMake projects, ignoring --time-trace%s\n", Yellow, Reset)
+		}
+		return runMesonBuild(release, target, clean, verbose, optLevel, sanitizer, unity, lto, linker, stats, remote)
 	case ProjectTypeVcpkg:
 		if watch {
-			return build.WatchAndBuild(release, jobs, target, optLevel, verbose, sanitizer, client)
+			return build.WatchAndBuild(release, jobs, target, optLevel, verbose, sanitizer, unity, lto, pgo, linker, client)
 		}
-		return build.BuildProject(release, jobs, target, clean, optLevel, verbose, sanitizer, client)
+		return build.BuildProject(release, jobs, target, clean, optLevel, verbose, sanitizer, unity, lto, pgo, linker, timeTrace, stats, remote, client)
 	default:
 		// Fall back to CMake build even without vcpkg.json
 		if watch {
-			return build.WatchAndBuild(release, jobs, target, optLevel, verbose, sanitizer, client)
+			return build.WatchAndBuild(release, jobs, target, optLevel, verbose, sanitizer, unity, lto, pgo, linker, client)
 		}
-		return build.BuildProject(release, jobs, target, clean, optLevel, verbose, sanitizer, client)
+		return build.BuildProject(release, jobs, target, clean, optLevel, verbose, sanitizer, unity, lto, pgo, linker, timeTrace, stats, remote, client)
 	}
 }
 
-func runBazelBuild(release bool, target string, clean bool, verbose bool, optLevel string, sanitizer string) error {
+func runBazelBuild(release bool, target string, clean bool, verbose bool, optLevel string, sanitizer string, lto string, linker string, remote bool) error {
 	// Clean if requested
 	if clean {
 		fmt.Printf("%sCleaning Bazel build...%s\n", Cyan, Reset)
@@ -184,6 +263,29 @@ func runBazelBuild(release bool, target string, clean bool, verbose bool, optLev
 		}
 	}
 
+	// Add LTO flags
+	switch lto {
+	case "thin":
+		bazelArgs = append(bazelArgs, "--features=thin_lto")
+		optLabel += "+thinlto"
+	case "full":
+		bazelArgs = append(bazelArgs, "--copt=-flto", "--linkopt=-flto")
+		optLabel += "+lto"
+	}
+
+	// Add fast linker flags (.bazelrc also ships build:mold / build:lld configs)
+	if linker != "" {
+		bazelArgs = append(bazelArgs, "--linkopt=-fuse-ld="+linker)
+		optLabel += "+" + linker
+	}
+
+	// Remote execution: the endpoints live in the project's .bazelrc
+	// build:remote block, this just selects the config
+	if remote {
+		bazelArgs = append(bazelArgs, "--config=remote")
+		optLabel += "+remote"
+	}
+
 	// Add target or default to //...
 	if target != "" {
 		bazelArgs = append(bazelArgs, target)
@@ -270,9 +372,20 @@ func runBazelBuild(release bool, target string, clean bool, verbose bool, optLev
 	return nil
 }
 
-func runMesonBuild(release bool, target string, clean bool, verbose bool, optLevel string, sanitizer string) error {
+func runMesonBuild(release bool, target string, clean bool, verbose bool, optLevel string, sanitizer string, unity bool, lto string, linker string, stats bool, remote bool) error {
 	buildDir := "builddir"
 
+	// Meson has no launcher option, so remote builds wrap the compiler via
+	// CC/CXX at setup time and inflate the compile parallelism
+	remoteLauncher := ""
+	if remote {
+		var err error
+		remoteLauncher, err = build.DetectRemoteLauncher()
+		if err != nil {
+			return err
+		}
+	}
+
 	// Determine build type and optimization from flags
 	buildType := "debug"
 	optimization := "0" // Meson optimization: 0, 1, 2, 3, s
@@ -321,6 +434,9 @@ func runMesonBuild(release bool, target string, clean bool, verbose bool, optLev
 	if sanitizer != "" {
 		optLabel += "+" + sanitizer
 	}
+	if linker != "" {
+		optLabel += "+" + linker
+	}
 
 	// Clean if requested or if optimization changed
 	if clean {
@@ -338,7 +454,24 @@ func runMesonBuild(release bool, target string, clean bool, verbose bool, optLev
 			// Add -ffast-math for -Ofast equivalent
 			setupArgs = append(setupArgs, "-Dc_args=-ffast-math", "-Dcpp_args=-ffast-math")
 		}
+		if unity {
+			setupArgs = append(setupArgs, "--unity", "on")
+		}
+		if lto != "" {
+			setupArgs = append(setupArgs, "-Db_lto=true")
+			if lto == "thin" {
+				setupArgs = append(setupArgs, "-Db_lto_mode=thin")
+			}
+		}
+		if linker != "" {
+			setupArgs = append(setupArgs, "-Dc_link_args=-fuse-ld="+linker, "-Dcpp_link_args=-fuse-ld="+linker)
+		}
 		setupCmd := execCommand("meson", setupArgs...)
+		if remote {
+			setupCmd.Env = append(os.Environ(),
+				"CC="+remoteLauncher+" cc",
+				"CXX="+remoteLauncher+" c++")
+		}
 		setupCmd.Stdout = os.Stdout
 		setupCmd.Stderr = os.Stderr
 		if err := setupCmd.Run(); err != nil {
@@ -346,6 +479,9 @@ func runMesonBuild(release bool, target string, clean bool, verbose bool, optLev
 		}
 	} else {
 		// Build directory exists, reconfigure if optimization changed
+		if remote {
+			fmt.Printf("%sRemote compiler wrapping applies at setup; use --clean to re-setup through %s%s\n", Yellow, remoteLauncher, Reset)
+		}
 		fmt.Printf("%sReconfiguring Meson [%s]...%s\n", Cyan, optLabel, Reset)
 		reconfigArgs := []string{"configure", buildDir}
 		reconfigArgs = append(reconfigArgs, "--buildtype="+buildType)
@@ -353,6 +489,18 @@ func runMesonBuild(release bool, target string, clean bool, verbose bool, optLev
 		if optLevel == "fast" {
 			reconfigArgs = append(reconfigArgs, "-Dc_args=-ffast-math", "-Dcpp_args=-ffast-math")
 		}
+		if unity {
+			reconfigArgs = append(reconfigArgs, "-Dunity=on")
+		}
+		if lto != "" {
+			reconfigArgs = append(reconfigArgs, "-Db_lto=true")
+			if lto == "thin" {
+				reconfigArgs = append(reconfigArgs, "-Db_lto_mode=thin")
+			}
+		}
+		if linker != "" {
+			reconfigArgs = append(reconfigArgs, "-Dc_link_args=-fuse-ld="+linker, "-Dcpp_link_args=-fuse-ld="+linker)
+		}
 		reconfigCmd := execCommand("meson", reconfigArgs...)
 		reconfigCmd.Stdout = os.Stdout
 		reconfigCmd.Stderr = os.Stderr
@@ -360,9 +508,19 @@ func runMesonBuild(release bool, target string, clean bool, verbose bool, optLev
 		reconfigCmd.Run()
 	}
 
+	// Meson builds through Ninja, so the same log-based telemetry applies
+	var ninjaLogOffset int64
+	if stats {
+		ninjaLogOffset = build.SnapshotNinjaLog(buildDir)
+	}
+
 	// Build
 	fmt.Printf("%sBuilding with Meson...%s\n", Cyan, Reset)
 	compileArgs := []string{"compile", "-C", buildDir}
+	if remote {
+		// Local core count would leave the farm idle
+		compileArgs = append(compileArgs, "-j", fmt.Sprintf("%d", build.RemoteJobs(remoteLauncher)))
+	}
 	if target != "" {
 		compileArgs = append(compileArgs, target)
 	}
@@ -412,6 +570,10 @@ func runMesonBuild(release bool, target string, clean bool, verbose bool, optLev
 	copyCmd.Stderr = os.Stderr
 	copyCmd.Run()
 
+	if stats {
+		build.RecordBuildStats(buildDir, "meson-"+optLabel, ninjaLogOffset)
+	}
+
 	fmt.Printf("%s✓ Build successful%s\n", Green, Reset)
 	fmt.Printf("  Artifacts in: %s/\n", outputDir)
 	return nil
@@ -0,0 +1,244 @@
+package cli
+
+import (
+	"fmt"
+	"os"
+	"path/filepath"
+	"time"
+
+	"github.com/ozacod/cpx/internal/pkg/build"
+	"github.com/ozacod/cpx/internal/pkg/vcpkg"
+	"github.com/ozacod/cpx/pkg/config"
+	"github.com/spf13/cobra"
+)
+
+// CacheCmd creates the cache command
+func CacheCmd() *cobra.Command {
+	cmd := &cobra.Command{
+		Use:   "cache",
+		Short: "Manage compiler and dependency caches",
+		Long: `Manage compiler caches (ccache/sccache) and the vcpkg binary cache.
+
+cpx automatically routes compilation through ccache or sccache when one is
+found in PATH. Set CPX_COMPILER_LAUNCHER to override detection, or set it
+to "none" to disable caching.
+
+vcpkg dependency builds are cached as prebuilt binaries (filesystem backend
+by default, shared HTTP store via set-remote) so fresh checkouts restore
+dependencies in seconds instead of rebuilding them from source.`,
+		Example: `  cpx cache stats                         # Show cache hit rates and sizes
+  cpx cache zero                          # Reset compiler cache statistics
+  cpx cache set-remote https://cache.internal/vcpkg  # Shared artifact store
+  cpx cache set-dir /mnt/shared/vcpkg-cache          # Filesystem backend
+  cpx cache prune --older-than 30         # Drop binaries unused for 30 days`,
+	}
+
+	cmd.AddCommand(cacheStatsCmd())
+	cmd.AddCommand(cacheZeroCmd())
+	cmd.AddCommand(cacheSetRemoteCmd())
+	cmd.AddCommand(cacheSetDirCmd())
+	cmd.AddCommand(cachePruneCmd())
+
+	return cmd
+}
+
+func cacheStatsCmd() *cobra.Command {
+	return &cobra.Command{
+		Use:   "stats",
+		Short: "Show compiler cache statistics (hit rates)",
+		RunE: func(cmd *cobra.Command, args []string) error {
+			return runCacheStats()
+		},
+	}
+}
+
+func cacheZeroCmd() *cobra.Command {
+	return &cobra.Command{
+		Use:   "zero",
+		Short: "Reset compiler cache statistics",
+		RunE: func(cmd *cobra.Command, args []string) error {
+			return runCacheZero()
+		},
+	}
+}
+
+func runCacheStats() error {
+	launcher := build.DetectCompilerLauncher()
+	if launcher == "" {
+		fmt.Printf("%sNo compiler cache found (install ccache or sccache; builds pick it up automatically)%s\n", Yellow, Reset)
+	} else {
+		fmt.Printf("%sCompiler cache: %s%s\n\n", Cyan, launcher, Reset)
+
+		statsCmd := execCommand(launcher, "--show-stats")
+		statsCmd.Stdout = os.Stdout
+		statsCmd.Stderr = os.Stderr
+		if err := statsCmd.Run(); err != nil {
+			return fmt.Errorf("failed to get %s stats: %w", launcher, err)
+		}
+	}
+
+	return showVcpkgBinaryCacheStats()
+}
+
+func showVcpkgBinaryCacheStats() error {
+	cfg, err := config.LoadGlobal()
+	if err != nil {
+		return fmt.Errorf("failed to load config: %w", err)
+	}
+
+	cacheDir := cfg.VcpkgBinaryCacheDir
+	if cacheDir == "" {
+		cacheDir = vcpkg.DefaultBinaryCacheDir()
+	}
+
+	fmt.Printf("\n%svcpkg binary cache%s\n", Cyan, Reset)
+	fmt.Printf("  Directory: %s\n", cacheDir)
+	if cfg.VcpkgBinaryCacheURL != "" {
+		fmt.Printf("  Remote:    %s\n", cfg.VcpkgBinaryCacheURL)
+	}
+
+	entries, totalSize := scanBinaryCache(cacheDir)
+	fmt.Printf("  Entries:   %d\n", entries)
+	fmt.Printf("  Size:      %.1f MB\n", float64(totalSize)/(1024*1024))
+	return nil
+}
+
+// scanBinaryCache walks the binary cache directory and returns the number of
+// cached packages and their total size in bytes
+func scanBinaryCache(cacheDir string) (int, int64) {
+	entries := 0
+	var totalSize int64
+	filepath.Walk(cacheDir, func(path string, info os.FileInfo, err error) error {
+		if err != nil || info.IsDir() {
+			return nil
+		}
+		entries++
+		totalSize += info.Size()
+		return nil
+	})
+	return entries, totalSize
+}
+
+func cacheSetRemoteCmd() *cobra.Command {
+	return &cobra.Command{
+		Use:   "set-remote <url>",
+		Short: "Point the vcpkg binary cache at a shared HTTP artifact store",
+		Args:  cobra.ExactArgs(1),
+		RunE: func(cmd *cobra.Command, args []string) error {
+			return runCacheSetRemote(args[0])
+		},
+	}
+}
+
+func cacheSetDirCmd() *cobra.Command {
+	return &cobra.Command{
+		Use:   "set-dir <path>",
+		Short: "Set the filesystem directory for the vcpkg binary cache",
+		Args:  cobra.ExactArgs(1),
+		RunE: func(cmd *cobra.Command, args []string) error {
+			return runCacheSetDir(args[0])
+		},
+	}
+}
+
+func cachePruneCmd() *cobra.Command {
+	cmd := &cobra.Command{
+		Use:   "prune",
+		Short: "Remove stale entries from the vcpkg binary cache",
+		RunE: func(cmd *cobra.Command, args []string) error {
+			olderThan, _ := cmd.Flags().GetInt("older-than")
+			return runCachePrune(olderThan)
+		},
+	}
+	cmd.Flags().Int("older-than", 30, "Remove entries not touched in this many days")
+	return cmd
+}
+
+func runCacheSetRemote(url string) error {
+	cfg, err := config.LoadGlobal()
+	if err != nil {
+		cfg = &config.GlobalConfig{}
+	}
+
+	cfg.VcpkgBinaryCacheURL = url
+	if err := config.SaveGlobal(cfg); err != nil {
+		return fmt.Errorf("failed to save config: %w", err)
+	}
+
+	fmt.Printf("%s✓ Set vcpkg binary cache remote to %s%s\n", Green, url, Reset)
+	return nil
+}
+
+func runCacheSetDir(path string) error {
+	absPath, err := filepath.Abs(path)
+	if err != nil {
+		return fmt.Errorf("failed to get absolute path: %w", err)
+	}
+	if err := os.MkdirAll(absPath, 0755); err != nil {
+		return fmt.Errorf("failed to create cache directory: %w", err)
+	}
+
+	cfg, err := config.LoadGlobal()
+	if err != nil {
+		cfg = &config.GlobalConfig{}
+	}
+
+	cfg.VcpkgBinaryCacheDir = absPath
+	if err := config.SaveGlobal(cfg); err != nil {
+		return fmt.Errorf("failed to save config: %w", err)
+	}
+
+	fmt.Printf("%s✓ Set vcpkg binary cache directory to %s%s\n", Green, absPath, Reset)
+	return nil
+}
+
+func runCachePrune(olderThanDays int) error {
+	cfg, err := config.LoadGlobal()
+	if err != nil {
+		return fmt.Errorf("failed to load config: %w", err)
+	}
+
+	cacheDir := cfg.VcpkgBinaryCacheDir
+	if cacheDir == "" {
+		cacheDir = vcpkg.DefaultBinaryCacheDir()
+	}
+
+	cutoff := time.Now().AddDate(0, 0, -olderThanDays)
+	pruned := 0
+	var reclaimed int64
+	filepath.Walk(cacheDir, func(path string, info os.FileInfo, err error) error {
+		if err != nil || info.IsDir() {
+			return nil
+		}
+		// vcpkg touches cached archives on restore, so mtime tracks last use
+		if info.ModTime().Before(cutoff) {
+			if err := os.Remove(path); err == nil {
+				pruned++
+				reclaimed += info.Size()
+			}
+		}
+		return nil
+	})
+
+	fmt.Printf("%s%s Pruned %d entries (%.1f MB) from %s%s\n",
+		Green, IconSuccess, pruned, float64(reclaimed)/(1024*1024), cacheDir, Reset)
+	return nil
+}
+
+func runCacheZero() error {
+	launcher := build.DetectCompilerLauncher()
+	if launcher == "" {
+		return fmt.Errorf("no compiler cache found (install ccache or sccache)")
+	}
+
+	// ccache uses --zero-stats; sccache has --zero-stats as well
+	zeroCmd := execCommand(launcher, "--zero-stats")
+	zeroCmd.Stdout = os.Stdout
+	zeroCmd.Stderr = os.Stderr
+	if err := zeroCmd.Run(); err != nil {
+		return fmt.Errorf("failed to reset %s stats: %w", launcher, err)
+	}
+
+	fmt.Printf("%s%s %s statistics reset%s\n", Green, IconSuccess, launcher, Reset)
+	return nil
+}
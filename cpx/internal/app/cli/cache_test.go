@@ -0,0 +1,60 @@
+package cli
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"github.com/ozacod/cpx/pkg/config"
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestRunCacheSetDir(t *testing.T) {
+	tmpDir := t.TempDir()
+	t.Setenv("HOME", tmpDir)
+
+	cacheDir := filepath.Join(tmpDir, "shared-cache")
+	err := runCacheSetDir(cacheDir)
+	assert.NoError(t, err)
+	assert.DirExists(t, cacheDir)
+
+	cfg, err := config.LoadGlobal()
+	require.NoError(t, err)
+	assert.Equal(t, cacheDir, cfg.VcpkgBinaryCacheDir)
+}
+
+func TestRunCacheSetRemote(t *testing.T) {
+	tmpDir := t.TempDir()
+	t.Setenv("HOME", tmpDir)
+
+	err := runCacheSetRemote("https://cache.example.com/vcpkg")
+	assert.NoError(t, err)
+
+	cfg, err := config.LoadGlobal()
+	require.NoError(t, err)
+	assert.Equal(t, "https://cache.example.com/vcpkg", cfg.VcpkgBinaryCacheURL)
+}
+
+func TestRunCachePrune(t *testing.T) {
+	tmpDir := t.TempDir()
+	t.Setenv("HOME", tmpDir)
+
+	cacheDir := filepath.Join(tmpDir, "binary-cache")
+	require.NoError(t, runCacheSetDir(cacheDir))
+
+	// One stale entry, one fresh entry
+	stale := filepath.Join(cacheDir, "stale.zip")
+	fresh := filepath.Join(cacheDir, "fresh.zip")
+	require.NoError(t, os.WriteFile(stale, []byte("old"), 0644))
+	require.NoError(t, os.WriteFile(fresh, []byte("new"), 0644))
+	old := time.Now().AddDate(0, 0, -60)
+	require.NoError(t, os.Chtimes(stale, old, old))
+
+	err := runCachePrune(30)
+	assert.NoError(t, err)
+
+	assert.NoFileExists(t, stale)
+	assert.FileExists(t, fresh)
+}
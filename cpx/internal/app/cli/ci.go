@@ -2,6 +2,7 @@ package cli
 
 import (
 	"fmt"
+	"io"
 	"os"
 	"os/exec"
 	"path/filepath"
@@ -29,6 +30,7 @@ func CICmd() *cobra.Command {
 	}
 	buildCmd.Flags().String("target", "", "Build only specific target (default: all)")
 	buildCmd.Flags().Bool("rebuild", false, "Rebuild Docker images even if they exist")
+	buildCmd.Flags().IntP("jobs", "j", 0, "Max targets to build concurrently (0 = all at once, 1 = serial)")
 	cmd.AddCommand(buildCmd)
 
 	// Add run subcommand - builds and runs a specific target
@@ -86,14 +88,15 @@ func CICmd() *cobra.Command {
 func runCIBuildCmd(cmd *cobra.Command, _ []string) error {
 	target, _ := cmd.Flags().GetString("target")
 	rebuild, _ := cmd.Flags().GetBool("rebuild")
-	return runCIBuild(target, rebuild, false)
+	jobs, _ := cmd.Flags().GetInt("jobs")
+	return runCIBuild(target, rebuild, false, jobs)
 }
 
 func runCIRun(cmd *cobra.Command, _ []string) error {
 	target, _ := cmd.Flags().GetString("target")
 	rebuild, _ := cmd.Flags().GetBool("rebuild")
-	// Build and then run the executable
-	return runCIBuild(target, rebuild, true)
+	// Build and then run the executable; running is interactive, so serial
+	return runCIBuild(target, rebuild, true, 1)
 }
 
 // runAddTarget adds a build target to cpx.ci
@@ -537,7 +540,7 @@ func deriveTargetConfig(name string) config.CITarget {
 
 var ciCommandExecuted = false
 
-func runCIBuild(targetName string, rebuild bool, executeAfterBuild bool) error {
+func runCIBuild(targetName string, rebuild bool, executeAfterBuild bool, jobs int) error {
 	if ciCommandExecuted {
 		fmt.Printf("%s[DEBUG] CI command already executed in this process (PID: %d), skipping second invocation.%s\n", Yellow, os.Getpid(), Reset)
 		return nil
@@ -619,6 +622,16 @@ func runCIBuild(targetName string, rebuild bool, executeAfterBuild bool) error {
 		}
 	}
 
+	// The target builds are independent; run them concurrently unless the
+	// user forces serial execution or we need the terminal for cpx ci run
+	if !executeAfterBuild && len(targets) > 1 && jobs != 1 {
+		if err := buildCITargetsParallel(targets, jobs, absDockerfilesDir, projectRoot, outputDir, ciConfig.Build, rebuild); err != nil {
+			return err
+		}
+		fmt.Printf("   Artifacts are in: %s\n", outputDir)
+		return nil
+	}
+
 	// Build and run for each target
 	for i, target := range targets {
 		if executeAfterBuild {
@@ -627,26 +640,8 @@ func runCIBuild(targetName string, rebuild bool, executeAfterBuild bool) error {
 			fmt.Printf("\n%s[%d/%d] Building target: %s%s\n", Cyan, i+1, len(targets), target.Name, Reset)
 		}
 
-		// Build Docker image
-		// Check if Dockerfile exists as specified, or try prepending Dockerfile.
-		dockerfilePath := filepath.Join(absDockerfilesDir, target.Source)
-		if _, err := os.Stat(dockerfilePath); os.IsNotExist(err) {
-			// Try prepending Dockerfile.
-			altPath := filepath.Join(absDockerfilesDir, "Dockerfile."+target.Source)
-			if _, err := os.Stat(altPath); err == nil {
-				dockerfilePath = altPath
-			} else {
-				return fmt.Errorf("dockerfile not found: %s (or Dockerfile.%s)\n  Run 'cpx upgrade' to download Dockerfiles", target.Source, target.Source)
-			}
-		}
-
-		if err := buildDockerImage(dockerfilePath, target.Tag, rebuild); err != nil {
-			return fmt.Errorf("failed to build Docker image %s: %w", target.Tag, err)
-		}
-
-		// Run build in Docker container
-		if err := runDockerBuild(target, projectRoot, outputDir, ciConfig.Build, executeAfterBuild); err != nil {
-			return fmt.Errorf("failed to build target %s: %w", target.Name, err)
+		if err := buildCITarget(target, absDockerfilesDir, projectRoot, outputDir, ciConfig.Build, rebuild, executeAfterBuild, os.Stdout); err != nil {
+			return err
 		}
 
 		if executeAfterBuild {
@@ -663,6 +658,38 @@ func runCIBuild(targetName string, rebuild bool, executeAfterBuild bool) error {
 	return nil
 }
 
+// resolveDockerfilePath locates a target's Dockerfile, accepting either the
+// full file name or the bare target name
+func resolveDockerfilePath(absDockerfilesDir, source string) (string, error) {
+	dockerfilePath := filepath.Join(absDockerfilesDir, source)
+	if _, err := os.Stat(dockerfilePath); os.IsNotExist(err) {
+		altPath := filepath.Join(absDockerfilesDir, "Dockerfile."+source)
+		if _, err := os.Stat(altPath); err == nil {
+			return altPath, nil
+		}
+		return "", fmt.Errorf("dockerfile not found: %s (or Dockerfile.%s)\n  Run 'cpx upgrade' to download Dockerfiles", source, source)
+	}
+	return dockerfilePath, nil
+}
+
+// buildCITarget builds one CI target end to end (image + containerized
+// build), writing all output to out so parallel builds can prefix it
+func buildCITarget(target config.CITarget, absDockerfilesDir, projectRoot, outputDir string, buildConfig config.CIBuild, rebuild bool, executeAfterBuild bool, out io.Writer) error {
+	dockerfilePath, err := resolveDockerfilePath(absDockerfilesDir, target.Source)
+	if err != nil {
+		return err
+	}
+
+	if err := buildDockerImage(dockerfilePath, target.Tag, rebuild, out); err != nil {
+		return fmt.Errorf("failed to build Docker image %s: %w", target.Tag, err)
+	}
+
+	if err := runDockerBuild(target, projectRoot, outputDir, buildConfig, executeAfterBuild, out); err != nil {
+		return fmt.Errorf("failed to build target %s: %w", target.Name, err)
+	}
+	return nil
+}
+
 func findProjectRoot() (string, error) {
 	dir, err := os.Getwd()
 	if err != nil {
@@ -695,18 +722,18 @@ func findProjectRoot() (string, error) {
 	}
 }
 
-func buildDockerImage(dockerfilePath, imageName string, rebuild bool) error {
+func buildDockerImage(dockerfilePath, imageName string, rebuild bool, out io.Writer) error {
 	// Check if image already exists
 	if !rebuild {
 		cmd := exec.Command("docker", "images", "-q", imageName)
 		output, err := cmd.Output()
 		if err == nil && len(output) > 0 {
-			fmt.Printf("  %s Docker image %s already exists%s\n", Green, imageName, Reset)
+			fmt.Fprintf(out, "  %s Docker image %s already exists%s\n", Green, imageName, Reset)
 			return nil
 		}
 	}
 
-	fmt.Printf("  %s Building Docker image: %s...%s\n", Cyan, imageName, Reset)
+	fmt.Fprintf(out, "  %s Building Docker image: %s...%s\n", Cyan, imageName, Reset)
 
 	// Get absolute paths
 	absDockerfilePath, err := filepath.Abs(dockerfilePath)
@@ -735,12 +762,12 @@ func buildDockerImage(dockerfilePath, imageName string, rebuild bool) error {
 	buildArgs = append(buildArgs, dockerfileDir)
 
 	cmd := exec.Command("docker", buildArgs...)
-	cmd.Stdout = os.Stdout
-	cmd.Stderr = os.Stderr
+	cmd.Stdout = out
+	cmd.Stderr = out
 
 	// If buildx fails, fall back to regular docker build
 	if err := cmd.Run(); err != nil {
-		fmt.Printf("  %s  docker buildx failed, trying regular docker build...%s\n", Yellow, Reset)
+		fmt.Fprintf(out, "  %s  docker buildx failed, trying regular docker build...%s\n", Yellow, Reset)
 		// Fallback to regular docker build
 		buildArgs = []string{"build", "-f", absDockerfilePath, "-t", imageName}
 		// if platform != "" {
@@ -749,14 +776,14 @@ func buildDockerImage(dockerfilePath, imageName string, rebuild bool) error {
 		buildArgs = append(buildArgs, dockerfileDir)
 
 		cmd = exec.Command("docker", buildArgs...)
-		cmd.Stdout = os.Stdout
-		cmd.Stderr = os.Stderr
+		cmd.Stdout = out
+		cmd.Stderr = out
 		if err := cmd.Run(); err != nil {
 			return fmt.Errorf("docker build failed: %w", err)
 		}
 	}
 
-	fmt.Printf("  %s Docker image %s built successfully%s\n", Green, imageName, Reset)
+	fmt.Fprintf(out, "  %s Docker image %s built successfully%s\n", Green, imageName, Reset)
 	return nil
 }
 
@@ -799,7 +826,7 @@ func detectProjectType(projectRoot string) (bool, error) {
 	return true, nil
 }
 
-func runDockerBuild(target config.CITarget, projectRoot, outputDir string, buildConfig config.CIBuild, executeAfterBuild bool) error {
+func runDockerBuild(target config.CITarget, projectRoot, outputDir string, buildConfig config.CIBuild, executeAfterBuild bool, out io.Writer) error {
 	// Create target-specific output directory
 	targetOutputDir := filepath.Join(outputDir, target.Name)
 	if err := os.MkdirAll(targetOutputDir, 0755); err != nil {
@@ -813,12 +840,12 @@ func runDockerBuild(target config.CITarget, projectRoot, outputDir string, build
 	}
 
 	if isBazel {
-		return runDockerBazelBuild(target, projectRoot, outputDir, buildConfig)
+		return runDockerBazelBuild(target, projectRoot, outputDir, buildConfig, out)
 	}
 
 	// Check if this is a Meson project
 	if _, err := os.Stat(filepath.Join(projectRoot, "meson.build")); err == nil {
-		return runDockerMesonBuild(target, projectRoot, outputDir, buildConfig)
+		return runDockerMesonBuild(target, projectRoot, outputDir, buildConfig, out)
 	}
 
 	// Detect project type (executable or library) for CMake projects
@@ -924,6 +951,13 @@ find %s -maxdepth 2 -type f \( -name "lib*.a" -o -name "lib*.so" -o -name "lib*.
 	vcpkgBuildtreesDir := filepath.Join(vcpkgCacheDir, "buildtrees")
 	vcpkgBinaryDir := filepath.Join(vcpkgCacheDir, "binary")
 
+	// Compiler cache, keyed per target like the vcpkg cache so different
+	// toolchains never share object files
+	ccacheDir := filepath.Join(absBuildDir, ".ccache")
+	if err := os.MkdirAll(ccacheDir, 0755); err != nil {
+		return fmt.Errorf("failed to create ccache directory: %w", err)
+	}
+
 	// Create all vcpkg cache directories (must exist before Docker mount)
 	if err := os.MkdirAll(vcpkgInstalledDir, 0755); err != nil {
 		return fmt.Errorf("failed to create vcpkg installed directory: %w", err)
@@ -977,8 +1011,14 @@ export VCPKG_BUILDTREES_ROOT=%s
 export VCPKG_BINARY_SOURCES="files,%s,readwrite"
 # Disable metrics to speed up builds
 export VCPKG_DISABLE_METRICS=1
+# Compiler cache: persists between runs via the mounted /tmp/.ccache
+export CCACHE_DIR=/tmp/.ccache
+if command -v ccache >/dev/null 2>&1; then
+    export CMAKE_C_COMPILER_LAUNCHER=ccache
+    export CMAKE_CXX_COMPILER_LAUNCHER=ccache
+fi
 # Ensure directories exist
-mkdir -p /tmp/.vcpkg_cache
+mkdir -p /tmp/.vcpkg_cache "$CCACHE_DIR"
 mkdir -p "$VCPKG_INSTALLED_DIR" "$VCPKG_DOWNLOADS" "$VCPKG_BUILDTREES_ROOT" "%s" "$X_VCPKG_REGISTRIES_CACHE"
 # Ensure build directory exists (mounted from host)
 mkdir -p %s
@@ -1040,7 +1080,7 @@ fi
 	}())
 
 	// Run Docker container
-	fmt.Printf("  %s Running build in Docker container...%s\n", Cyan, Reset)
+	fmt.Fprintf(out, "  %s Running build in Docker container...%s\n", Cyan, Reset)
 
 	// Use platform from target config
 	// platform := target.Platform
@@ -1075,14 +1115,15 @@ fi
 		"-v", absBuildDir+":"+buildPath, // Mount build directory for caching build artifacts
 		"-v", absOutputDir+":"+outputPath, // Mount output directory for artifacts
 		"-v", absVcpkgCacheDir+":"+cachePath, // Mount vcpkg cache
+		"-v", ccacheDir+":/tmp/.ccache", // Mount compiler cache
 		"-w", workspacePath,
 		target.Tag,
 		command, "-c", buildScript)
 
 	cmd := exec.Command("docker", dockerArgs...)
 
-	cmd.Stdout = os.Stdout
-	cmd.Stderr = os.Stderr
+	cmd.Stdout = out
+	cmd.Stderr = out
 
 	if err := cmd.Run(); err != nil {
 		return fmt.Errorf("docker run failed: %w", err)
@@ -1092,7 +1133,7 @@ fi
 }
 
 // runDockerBazelBuild runs a Bazel build inside Docker
-func runDockerBazelBuild(target config.CITarget, projectRoot, outputDir string, buildConfig config.CIBuild) error {
+func runDockerBazelBuild(target config.CITarget, projectRoot, outputDir string, buildConfig config.CIBuild, out io.Writer) error {
 	// Get absolute paths
 	absProjectRoot, err := filepath.Abs(projectRoot)
 	if err != nil {
@@ -1161,7 +1202,7 @@ echo "  Build complete!"
 `, bazelConfig, target.Name, target.Name, target.Name)
 
 	// Run Docker container
-	fmt.Printf("  %s Running Bazel build in Docker container...%s\n", Cyan, Reset)
+	fmt.Fprintf(out, "  %s Running Bazel build in Docker container...%s\n", Cyan, Reset)
 
 	// platform := target.Platform
 	dockerArgs := []string{"run", "--rm"}
@@ -1183,8 +1224,8 @@ echo "  Build complete!"
 		"bash", "-c", buildScript)
 
 	cmd := exec.Command("docker", dockerArgs...)
-	cmd.Stdout = os.Stdout
-	cmd.Stderr = os.Stderr
+	cmd.Stdout = out
+	cmd.Stderr = out
 
 	if err := cmd.Run(); err != nil {
 		return fmt.Errorf("docker bazel build failed: %w", err)
@@ -1194,7 +1235,7 @@ echo "  Build complete!"
 }
 
 // runDockerMesonBuild runs a Meson build inside Docker
-func runDockerMesonBuild(target config.CITarget, projectRoot, outputDir string, buildConfig config.CIBuild) error {
+func runDockerMesonBuild(target config.CITarget, projectRoot, outputDir string, buildConfig config.CIBuild, out io.Writer) error {
 	// Get absolute paths
 	absProjectRoot, err := filepath.Abs(projectRoot)
 	if err != nil {
@@ -1258,8 +1299,18 @@ func runDockerMesonBuild(target config.CITarget, projectRoot, outputDir string,
 	// 	compileCmd += " -v"
 	// }
 
+	// Compiler cache, keyed per target; Meson picks up ccache automatically
+	// at setup time when it is on PATH
+	ccacheDir := filepath.Join(absBuildDir, ".ccache")
+	if err := os.MkdirAll(ccacheDir, 0755); err != nil {
+		return fmt.Errorf("failed to create ccache directory: %w", err)
+	}
+
 	buildScript := fmt.Sprintf(`#!/bin/bash
 set -e
+# Compiler cache: persists between runs via the mounted /tmp/.ccache
+export CCACHE_DIR=/tmp/.ccache
+mkdir -p "$CCACHE_DIR"
 # Ensure build directory exists (mounted from host)
 mkdir -p /tmp/builddir
 
@@ -1300,7 +1351,7 @@ echo "  Build complete!"
 `, strings.Join(setupArgs[2:], " "), target.Name, target.Name, target.Name, target.Name, target.Name)
 
 	// Run Docker container
-	fmt.Printf("  %s Running Meson build in Docker container...%s\n", Cyan, Reset)
+	fmt.Fprintf(out, "  %s Running Meson build in Docker container...%s\n", Cyan, Reset)
 
 	// platform := target.Platform
 	dockerArgs := []string{"run", "--rm"}
@@ -1314,13 +1365,14 @@ echo "  Build complete!"
 		"-v", absBuildDir+":/tmp/builddir", // Persistent build dir
 		"-v", absSubprojectsDir+":/workspace/subprojects", // Subprojects read-write for downloading wraps
 		"-v", absOutputDir+":/workspace/out", // Output dir
+		"-v", ccacheDir+":/tmp/.ccache", // Mount compiler cache
 		"-w", "/workspace",
 		target.Tag,
 		"bash", "-c", buildScript)
 
 	cmd := exec.Command("docker", dockerArgs...)
-	cmd.Stdout = os.Stdout
-	cmd.Stderr = os.Stderr
+	cmd.Stdout = out
+	cmd.Stderr = out
 
 	if err := cmd.Run(); err != nil {
 		return fmt.Errorf("docker meson build failed: %w", err)
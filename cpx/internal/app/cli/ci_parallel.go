@@ -0,0 +1,123 @@
+package cli
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"os"
+	"sync"
+	"time"
+
+	"github.com/ozacod/cpx/pkg/config"
+)
+
+// prefixWriter tags every output line with a colored target name so the
+// interleaved logs of concurrent builds stay readable. A shared mutex keeps
+// whole lines together on the terminal.
+type prefixWriter struct {
+	mu     *sync.Mutex
+	out    io.Writer
+	prefix string
+	buf    bytes.Buffer
+}
+
+func newPrefixWriter(mu *sync.Mutex, out io.Writer, name, color string) *prefixWriter {
+	return &prefixWriter{
+		mu:     mu,
+		out:    out,
+		prefix: fmt.Sprintf("%s[%s]%s ", color, name, Reset),
+	}
+}
+
+func (w *prefixWriter) Write(p []byte) (int, error) {
+	w.mu.Lock()
+	defer w.mu.Unlock()
+
+	w.buf.Write(p)
+	for {
+		line, err := w.buf.ReadString('\n')
+		if err != nil {
+			// Partial line; keep it buffered until the newline arrives
+			w.buf.WriteString(line)
+			break
+		}
+		fmt.Fprint(w.out, w.prefix+line)
+	}
+	return len(p), nil
+}
+
+// Flush writes any trailing partial line
+func (w *prefixWriter) Flush() {
+	w.mu.Lock()
+	defer w.mu.Unlock()
+
+	if w.buf.Len() > 0 {
+		fmt.Fprint(w.out, w.prefix+w.buf.String()+"\n")
+		w.buf.Reset()
+	}
+}
+
+// ciTargetResult is one row of the post-build summary table
+type ciTargetResult struct {
+	name     string
+	duration time.Duration
+	err      error
+}
+
+// prefixPalette cycles per-target colors for the multiplexed logs
+var prefixPalette = []string{Cyan, Green, Yellow, Red}
+
+// buildCITargetsParallel builds the given CI targets concurrently with at
+// most jobs in flight (0 = all at once), streaming prefixed logs and
+// printing a summary table. One target failing does not cancel the others.
+func buildCITargetsParallel(targets []config.CITarget, jobs int, absDockerfilesDir, projectRoot, outputDir string, buildConfig config.CIBuild, rebuild bool) error {
+	if jobs <= 0 || jobs > len(targets) {
+		jobs = len(targets)
+	}
+
+	fmt.Printf("%s Building %d targets in parallel (max %d at a time)...%s\n\n", Cyan, len(targets), jobs, Reset)
+
+	var outputMu sync.Mutex
+	var wg sync.WaitGroup
+	sem := make(chan struct{}, jobs)
+	results := make([]ciTargetResult, len(targets))
+	start := time.Now()
+
+	for i, target := range targets {
+		wg.Add(1)
+		go func(i int, target config.CITarget) {
+			defer wg.Done()
+			sem <- struct{}{}
+			defer func() { <-sem }()
+
+			out := newPrefixWriter(&outputMu, os.Stdout, target.Name, prefixPalette[i%len(prefixPalette)])
+			targetStart := time.Now()
+			err := buildCITarget(target, absDockerfilesDir, projectRoot, outputDir, buildConfig, rebuild, false, out)
+			out.Flush()
+
+			results[i] = ciTargetResult{name: target.Name, duration: time.Since(targetStart), err: err}
+		}(i, target)
+	}
+	wg.Wait()
+
+	// Summary table in cpx.ci order
+	fmt.Printf("\n%sSummary%s %s(total: %s)%s\n", Cyan, Reset, Dim, time.Since(start).Round(time.Second), Reset)
+	failed := 0
+	for _, result := range results {
+		status := Green + IconSuccess + " ok" + Reset
+		if result.err != nil {
+			status = Red + IconError + " failed" + Reset
+			failed++
+		}
+		fmt.Printf("  %-24s %10s  %s\n", result.name, result.duration.Round(time.Second), status)
+		if result.err != nil {
+			fmt.Printf("    %s%v%s\n", Dim, result.err, Reset)
+		}
+	}
+
+	if failed > 0 {
+		return fmt.Errorf("%d of %d target(s) failed", failed, len(targets))
+	}
+	fmt.Printf("\n%s All targets built successfully!%s\n", Green, Reset)
+	return nil
+}
@@ -0,0 +1,48 @@
+package cli
+
+import (
+	"bytes"
+	"strings"
+	"sync"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+)
+
+func TestPrefixWriter(t *testing.T) {
+	var out bytes.Buffer
+	var mu sync.Mutex
+	w := newPrefixWriter(&mu, &out, "linux-amd64", "")
+
+	w.Write([]byte("first line\nsecond "))
+	w.Write([]byte("line\n"))
+	w.Write([]byte("trailing without newline"))
+	w.Flush()
+
+	lines := strings.Split(strings.TrimRight(out.String(), "\n"), "\n")
+	assert.Equal(t, []string{
+		"[linux-amd64]" + Reset + " first line",
+		"[linux-amd64]" + Reset + " second line",
+		"[linux-amd64]" + Reset + " trailing without newline",
+	}, lines)
+}
+
+func TestPrefixWriter_InterleavedLinesStayWhole(t *testing.T) {
+	var out bytes.Buffer
+	var mu sync.Mutex
+	a := newPrefixWriter(&mu, &out, "a", "")
+	b := newPrefixWriter(&mu, &out, "b", "")
+
+	var wg sync.WaitGroup
+	for i := 0; i < 50; i++ {
+		wg.Add(2)
+		go func() { defer wg.Done(); a.Write([]byte("aaaa\n")) }()
+		go func() { defer wg.Done(); b.Write([]byte("bbbb\n")) }()
+	}
+	wg.Wait()
+
+	for _, line := range strings.Split(strings.TrimRight(out.String(), "\n"), "\n") {
+		ok := strings.HasSuffix(line, " aaaa") || strings.HasSuffix(line, " bbbb")
+		assert.True(t, ok, "mixed line: %q", line)
+	}
+}
@@ -133,10 +133,16 @@ func cleanCMake(all bool) error {
 	removeDir(filepath.Join(".bin", "native"))
 
 	// Remove intermediate build directories (keep vcpkg_installed unless --all)
-	// We iterate common variants instead of blowing away .cache/native
-	variants := []string{"debug", "release", "O0", "O1", "O2", "O3", "Os", "Ofast"}
-	for _, v := range variants {
-		removeDir(filepath.Join(".cache", "native", v))
+	// Each configuration (debug, release, O2, debug-asan, release-lto-thin, ...)
+	// has its own directory, so scan instead of listing variants
+	entries, err := os.ReadDir(filepath.Join(".cache", "native"))
+	if err == nil {
+		for _, entry := range entries {
+			if !entry.IsDir() || entry.Name() == "vcpkg_installed" {
+				continue
+			}
+			removeDir(filepath.Join(".cache", "native", entry.Name()))
+		}
 	}
 
 	if all {
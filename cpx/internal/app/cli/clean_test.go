@@ -3,6 +3,7 @@ package cli
 import (
 	"os"
 	"os/exec"
+	"path/filepath"
 	"testing"
 
 	"github.com/stretchr/testify/assert"
@@ -313,3 +314,31 @@ func TestRunClean(t *testing.T) {
 		})
 	}
 }
+
+func TestCleanCMakeFlavoredVariants(t *testing.T) {
+	tmpDir := t.TempDir()
+	oldWd, err := os.Getwd()
+	require.NoError(t, err)
+	defer os.Chdir(oldWd)
+	require.NoError(t, os.Chdir(tmpDir))
+
+	require.NoError(t, os.WriteFile("CMakeLists.txt", []byte("cmake_minimum_required(VERSION 3.16)"), 0644))
+
+	// Per-configuration build trees, including suffixed flavors
+	variants := []string{"debug", "release", "O2", "debug-asan", "release-lto-thin", "debug-mold"}
+	for _, v := range variants {
+		require.NoError(t, os.MkdirAll(filepath.Join(".cache", "native", v), 0755))
+	}
+	require.NoError(t, os.MkdirAll(filepath.Join(".cache", "native", "vcpkg_installed"), 0755))
+
+	require.NoError(t, cleanCMake(false))
+
+	for _, v := range variants {
+		_, err := os.Stat(filepath.Join(".cache", "native", v))
+		assert.True(t, os.IsNotExist(err), "%s should be removed", v)
+	}
+
+	// Shared vcpkg dependencies survive a plain clean
+	_, err = os.Stat(filepath.Join(".cache", "native", "vcpkg_installed"))
+	assert.NoError(t, err)
+}
@@ -76,6 +76,8 @@ func createProjectFromTUI(config tui.ProjectConfig, vcpkgClient *vcpkg.Client) e
 	cfg := &tui.ProjectConfig{
 		Name:           projectName,
 		IsLibrary:      config.IsLibrary,
+		PerfCore:       config.PerfCore,
+		Simd:           config.Simd,
 		CppStandard:    config.CppStandard,
 		TestFramework:  config.TestFramework,
 		ClangFormat:    config.ClangFormat,
@@ -86,6 +88,7 @@ func createProjectFromTUI(config tui.ProjectConfig, vcpkgClient *vcpkg.Client) e
 		PreCommit:      config.PreCommit,
 		PrePush:        config.PrePush,
 		Benchmark:      config.Benchmark,
+		UsePch:         config.UsePch,
 	}
 
 	// Set hooks
@@ -126,7 +129,7 @@ func createProjectFromTUI(config tui.ProjectConfig, vcpkgClient *vcpkg.Client) e
 	projectVersion := "0.1.0"
 
 	// Generate benchmark artifacts if enabled
-	benchSources, _ := templates.GenerateBenchmarkSources(projectName, cfg.Benchmark)
+	benchSources, _ := templates.GenerateBenchmarkSources(projectName, cfg.Benchmark, cfg.PerfCore, cfg.Simd)
 
 	// Create directory structure
 	dirs := []string{
@@ -161,7 +164,7 @@ func createProjectFromTUI(config tui.ProjectConfig, vcpkgClient *vcpkg.Client) e
 		}
 
 		// Generate src/BUILD.bazel
-		srcBuild := templates.GenerateBuildBazelSrc(projectName, !cfg.IsLibrary)
+		srcBuild := templates.GenerateBuildBazelSrc(projectName, !cfg.IsLibrary, cfg.Simd)
 		if err := os.WriteFile(filepath.Join(projectName, "src/BUILD.bazel"), []byte(srcBuild), 0644); err != nil {
 			return fmt.Errorf("failed to write src/BUILD.bazel: %w", err)
 		}
@@ -191,7 +194,7 @@ func createProjectFromTUI(config tui.ProjectConfig, vcpkgClient *vcpkg.Client) e
 		}
 
 		// Generate src/meson.build
-		srcMeson := templates.GenerateMesonBuildSrc(projectName, !cfg.IsLibrary)
+		srcMeson := templates.GenerateMesonBuildSrc(projectName, !cfg.IsLibrary, cfg.UsePch, cfg.Simd)
 		if err := os.WriteFile(filepath.Join(projectName, "src/meson.build"), []byte(srcMeson), 0644); err != nil {
 			return fmt.Errorf("failed to write src/meson.build: %w", err)
 		}
@@ -242,7 +245,7 @@ func createProjectFromTUI(config tui.ProjectConfig, vcpkgClient *vcpkg.Client) e
 		}
 	} else {
 		// Generate CMakeLists.txt (vcpkg or none)
-		cmakeLists := templates.GenerateVcpkgCMakeLists(projectName, cppStandard, !cfg.IsLibrary, cfg.TestFramework != "" && cfg.TestFramework != "none", cfg.Benchmark, benchSources != nil, projectVersion)
+		cmakeLists := templates.GenerateVcpkgCMakeLists(projectName, cppStandard, !cfg.IsLibrary, cfg.TestFramework != "" && cfg.TestFramework != "none", cfg.Benchmark, benchSources != nil, projectVersion, cfg.UsePch, cfg.Simd)
 		if err := os.WriteFile(filepath.Join(projectName, "CMakeLists.txt"), []byte(cmakeLists), 0644); err != nil {
 			return fmt.Errorf("failed to write CMakeLists.txt: %w", err)
 		}
@@ -268,6 +271,32 @@ func createProjectFromTUI(config tui.ProjectConfig, vcpkgClient *vcpkg.Client) e
 		return fmt.Errorf("failed to write header: %w", err)
 	}
 
+	// Generate the high-performance core header if opted in (header-only, so
+	// no build system changes are needed)
+	if cfg.PerfCore {
+		coreHeader := templates.GenerateCoreHeader(projectName)
+		if err := os.WriteFile(filepath.Join(projectName, "include/"+projectName+"/core.hpp"), []byte(coreHeader), 0644); err != nil {
+			return fmt.Errorf("failed to write core.hpp: %w", err)
+		}
+	}
+
+	// Generate the SIMD kernel scaffold if opted in; the per-variant compile
+	// flags are wired into the build files generated above
+	if cfg.Simd {
+		simdHeader := templates.GenerateSimdHeader(projectName)
+		if err := os.WriteFile(filepath.Join(projectName, "include/"+projectName+"/simd.hpp"), []byte(simdHeader), 0644); err != nil {
+			return fmt.Errorf("failed to write simd.hpp: %w", err)
+		}
+		simdKernels := templates.GenerateSimdKernels(projectName)
+		if err := os.WriteFile(filepath.Join(projectName, "src/simd_kernels.cpp"), []byte(simdKernels), 0644); err != nil {
+			return fmt.Errorf("failed to write simd_kernels.cpp: %w", err)
+		}
+		simdDispatch := templates.GenerateSimdDispatch(projectName)
+		if err := os.WriteFile(filepath.Join(projectName, "src/simd_dispatch.cpp"), []byte(simdDispatch), 0644); err != nil {
+			return fmt.Errorf("failed to write simd_dispatch.cpp: %w", err)
+		}
+	}
+
 	// Generate main.cpp for executables
 	if !cfg.IsLibrary {
 		mainCpp := templates.GenerateMainCpp(projectName)
@@ -282,6 +311,22 @@ func createProjectFromTUI(config tui.ProjectConfig, vcpkgClient *vcpkg.Client) e
 		return fmt.Errorf("failed to write source: %w", err)
 	}
 
+	// Generate precompiled header if enabled (not supported for Bazel)
+	if cfg.UsePch && cfg.PackageManager != "bazel" {
+		pchHeader := templates.GeneratePchHeader(cfg.TestFramework, cfg.Benchmark)
+		pchPath := filepath.Join(projectName, "src", "pch.hpp")
+		if cfg.PackageManager == "meson" {
+			// Meson requires the PCH in its own directory
+			if err := os.MkdirAll(filepath.Join(projectName, "src", "pch"), 0755); err != nil {
+				return fmt.Errorf("failed to create pch directory: %w", err)
+			}
+			pchPath = filepath.Join(projectName, "src", "pch", "pch.hpp")
+		}
+		if err := os.WriteFile(pchPath, []byte(pchHeader), 0644); err != nil {
+			return fmt.Errorf("failed to write pch.hpp: %w", err)
+		}
+	}
+
 	// Generate benchmark files if enabled
 	if benchSources != nil {
 		benchPath := filepath.Join(projectName, "bench", "bench_main.cpp")
@@ -289,6 +334,11 @@ func createProjectFromTUI(config tui.ProjectConfig, vcpkgClient *vcpkg.Client) e
 			return fmt.Errorf("failed to write bench_main.cpp: %w", err)
 		}
 
+		perfPath := filepath.Join(projectName, "bench", "perf_counters.hpp")
+		if err := os.WriteFile(perfPath, []byte(benchSources.PerfHeader), 0644); err != nil {
+			return fmt.Errorf("failed to write perf_counters.hpp: %w", err)
+		}
+
 		if cfg.PackageManager == "bazel" {
 			// Generate bench/BUILD.bazel for Bazel projects
 			benchBuild := templates.GenerateBuildBazelBench(projectName, cfg.Benchmark)
@@ -303,7 +353,7 @@ func createProjectFromTUI(config tui.ProjectConfig, vcpkgClient *vcpkg.Client) e
 			}
 		} else {
 			// Generate bench/CMakeLists.txt for CMake projects
-			benchCMake := templates.GenerateBenchCMake(projectName, cfg.Benchmark)
+			benchCMake := templates.GenerateBenchCMake(projectName, cfg.Benchmark, cfg.Simd)
 			if err := os.WriteFile(filepath.Join(projectName, "bench/CMakeLists.txt"), []byte(benchCMake), 0644); err != nil {
 				return fmt.Errorf("failed to write bench/CMakeLists.txt: %w", err)
 			}
@@ -364,13 +414,13 @@ func createProjectFromTUI(config tui.ProjectConfig, vcpkgClient *vcpkg.Client) e
 			}
 		} else {
 			// Generate tests/CMakeLists.txt for CMake projects
-			testCMake := templates.GenerateTestCMake(projectName, cfg.TestFramework)
+			testCMake := templates.GenerateTestCMake(projectName, cfg.TestFramework, cfg.UsePch)
 			if err := os.WriteFile(filepath.Join(projectName, "tests/CMakeLists.txt"), []byte(testCMake), 0644); err != nil {
 				return fmt.Errorf("failed to write tests/CMakeLists.txt: %w", err)
 			}
 		}
 
-		testMain := templates.GenerateTestMain(projectName, cfg.TestFramework)
+		testMain := templates.GenerateTestMain(projectName, cfg.TestFramework, cfg.PerfCore)
 		if err := os.WriteFile(filepath.Join(projectName, "tests/test_main.cpp"), []byte(testMain), 0644); err != nil {
 			return fmt.Errorf("failed to write tests/test_main.cpp: %w", err)
 		}
@@ -0,0 +1,102 @@
+package cli
+
+import (
+	"fmt"
+	"os"
+	"path/filepath"
+	"strings"
+
+	"github.com/ozacod/cpx/internal/pkg/build"
+	"github.com/ozacod/cpx/internal/pkg/templates"
+	"github.com/spf13/cobra"
+)
+
+// PchCmd creates the pch command
+func PchCmd() *cobra.Command {
+	cmd := &cobra.Command{
+		Use:   "pch",
+		Short: "Add a precompiled header to an existing project",
+		Long: `Generate a precompiled header (src/pch.hpp) with the standard-library
+workhorses plus the chosen test/bench framework headers, and wire it into
+the build via target_precompile_headers (CMake) or cpp_pch (Meson).`,
+		Example: `  cpx pch                          # Generate pch.hpp and wire it up
+  cpx pch --test-framework googletest
+  cpx pch --bench-framework google-benchmark`,
+		RunE: func(cmd *cobra.Command, args []string) error {
+			testFramework, _ := cmd.Flags().GetString("test-framework")
+			benchFramework, _ := cmd.Flags().GetString("bench-framework")
+			return runPch(testFramework, benchFramework)
+		},
+	}
+
+	cmd.Flags().String("test-framework", "", "Test framework headers to include: googletest, catch2, doctest")
+	cmd.Flags().String("bench-framework", "", "Benchmark framework headers to include: google-benchmark, nanobench, catch2-benchmark")
+
+	return cmd
+}
+
+func runPch(testFramework, benchFramework string) error {
+	projectType, err := RequireProject("pch")
+	if err != nil {
+		return err
+	}
+
+	pchHeader := templates.GeneratePchHeader(testFramework, benchFramework)
+
+	switch projectType {
+	case ProjectTypeBazel:
+		return fmt.Errorf("precompiled headers are not supported for Bazel projects")
+
+	case ProjectTypeMeson:
+		// Meson requires the PCH in its own directory
+		pchDir := filepath.Join("src", "pch")
+		if err := os.MkdirAll(pchDir, 0755); err != nil {
+			return fmt.Errorf("failed to create pch directory: %w", err)
+		}
+		pchPath := filepath.Join(pchDir, "pch.hpp")
+		if err := os.WriteFile(pchPath, []byte(pchHeader), 0644); err != nil {
+			return fmt.Errorf("failed to write pch.hpp: %w", err)
+		}
+		fmt.Printf("%s%s Generated %s%s\n", Green, IconSuccess, pchPath, Reset)
+		fmt.Printf("  Add %scpp_pch : 'pch/pch.hpp'%s to your targets in src/meson.build\n", Cyan, Reset)
+		return nil
+
+	default:
+		// vcpkg / plain CMake
+		if err := os.MkdirAll("src", 0755); err != nil {
+			return fmt.Errorf("failed to create src directory: %w", err)
+		}
+		pchPath := filepath.Join("src", "pch.hpp")
+		if err := os.WriteFile(pchPath, []byte(pchHeader), 0644); err != nil {
+			return fmt.Errorf("failed to write pch.hpp: %w", err)
+		}
+		fmt.Printf("%s%s Generated %s%s\n", Green, IconSuccess, pchPath, Reset)
+
+		// Wire into CMakeLists.txt if not already done
+		data, err := os.ReadFile("CMakeLists.txt")
+		if err != nil {
+			fmt.Printf("  Add %starget_precompile_headers(<target> PRIVATE src/pch.hpp)%s to your CMakeLists.txt\n", Cyan, Reset)
+			return nil
+		}
+		if strings.Contains(string(data), "target_precompile_headers") {
+			fmt.Printf("  CMakeLists.txt already uses target_precompile_headers, leaving it unchanged\n")
+			return nil
+		}
+
+		projectName := build.GetProjectNameFromCMakeLists()
+		if projectName == "" {
+			fmt.Printf("  Add %starget_precompile_headers(<target> PRIVATE src/pch.hpp)%s to your CMakeLists.txt\n", Cyan, Reset)
+			return nil
+		}
+
+		block := fmt.Sprintf(`
+# Precompiled header (std-library workhorses + framework headers)
+target_precompile_headers(%s PRIVATE src/pch.hpp)
+`, projectName)
+		if err := os.WriteFile("CMakeLists.txt", append(data, []byte(block)...), 0644); err != nil {
+			return fmt.Errorf("failed to update CMakeLists.txt: %w", err)
+		}
+		fmt.Printf("%s%s Wired target_precompile_headers(%s) in CMakeLists.txt%s\n", Green, IconSuccess, projectName, Reset)
+		return nil
+	}
+}
@@ -24,6 +24,7 @@ Arguments after -- are passed to the binary.`,
 		Example: `  cpx run                 # Debug build by default
   cpx run --release        # Release build, then run
   cpx run --asan           # Run with AddressSanitizer
+  cpx run --pick           # Choose the target interactively
   cpx run --target app -- --flag value`,
 		RunE: func(cmd *cobra.Command, args []string) error {
 			return runRun(cmd, args, client)
@@ -32,6 +33,7 @@ Arguments after -- are passed to the binary.`,
 
 	cmd.Flags().Bool("release", false, "Build in release mode (-O2). Default is debug")
 	cmd.Flags().String("target", "", "Executable target to run (useful if multiple)")
+	cmd.Flags().Bool("pick", false, "Pick the target interactively from the build system's target list")
 	cmd.Flags().StringP("opt", "O", "", "Override optimization level: 0,1,2,3,s,fast")
 	cmd.Flags().Bool("verbose", false, "Show full build output")
 	// Sanitizer flags
@@ -80,6 +82,17 @@ func runRun(cmd *cobra.Command, args []string, client *vcpkg.Client) error {
 
 	projectType := DetectProjectType()
 
+	if pick, _ := cmd.Flags().GetBool("pick"); pick && target == "" {
+		picked, err := PickBuildTarget(projectType)
+		if err != nil {
+			return err
+		}
+		if picked == "" {
+			return nil // User cancelled
+		}
+		target = picked
+	}
+
 	switch projectType {
 	case ProjectTypeBazel:
 		return runBazelRun(release, target, args, verbose, optLevel, sanitizer)
@@ -174,7 +187,7 @@ func runBazelRun(release bool, target string, args []string, verbose bool, optLe
 
 func runMesonRun(release bool, target string, args []string, verbose bool, optLevel string, sanitizer string) error {
 	// Ensure project is built first
-	if err := runMesonBuild(release, target, false, verbose, optLevel, sanitizer); err != nil {
+	if err := runMesonBuild(release, target, false, verbose, optLevel, sanitizer, false, "", "", false, false); err != nil {
 		return fmt.Errorf("build failed: %w", err)
 	}
 
@@ -0,0 +1,274 @@
+package cli
+
+import (
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync"
+	"time"
+
+	"github.com/ozacod/cpx/internal/pkg/build"
+	"github.com/ozacod/cpx/internal/pkg/vcpkg"
+	"github.com/spf13/cobra"
+)
+
+// knownSanitizers is the order sanitizers run and report in
+var knownSanitizers = []string{"asan", "tsan", "ubsan", "msan"}
+
+// SanitizeCmd creates the sanitize command
+func SanitizeCmd(client *vcpkg.Client) *cobra.Command {
+	cmd := &cobra.Command{
+		Use:   "sanitize",
+		Short: "Build and test all sanitizer flavors in parallel",
+		Long: `Build and test the project under multiple sanitizers concurrently.
+
+Each sanitizer gets its own build directory (.cache/native/debug-<sanitizer>),
+so the flavors build in parallel without invalidating each other and stay warm
+for the next run. Findings are deduplicated across sanitizers and tests into
+one summary, making this a single pass you can gate merges on.`,
+		Example: `  cpx sanitize                       # asan, tsan and ubsan in parallel
+  cpx sanitize --sanitizers asan,ubsan
+  cpx sanitize --jobs 2              # At most 2 flavors at a time
+  cpx sanitize --filter MySuite.*    # Forwarded to ctest -R`,
+		RunE: func(cmd *cobra.Command, args []string) error {
+			return runSanitize(cmd, args, client)
+		},
+	}
+
+	cmd.Flags().String("sanitizers", "asan,tsan,ubsan", "Comma-separated sanitizers to run (asan, tsan, ubsan, msan)")
+	cmd.Flags().IntP("jobs", "j", 0, "Max sanitizer flavors building at once (0 = all)")
+	cmd.Flags().String("filter", "", "Filter tests by name (ctest regex)")
+	cmd.Flags().BoolP("verbose", "v", false, "Show full build and test output")
+
+	return cmd
+}
+
+func runSanitize(cmd *cobra.Command, _ []string, client *vcpkg.Client) error {
+	sanitizersFlag, _ := cmd.Flags().GetString("sanitizers")
+	jobs, _ := cmd.Flags().GetInt("jobs")
+	filter, _ := cmd.Flags().GetString("filter")
+	verbose, _ := cmd.Flags().GetBool("verbose")
+
+	sanitizers, err := parseSanitizerList(sanitizersFlag)
+	if err != nil {
+		return err
+	}
+
+	projectType := DetectProjectType()
+	if projectType == ProjectTypeBazel || projectType == ProjectTypeMeson {
+		return fmt.Errorf("cpx sanitize currently supports CMake/vcpkg projects; use 'cpx build --sanitizer' per flavor instead")
+	}
+
+	// Set VCPKG_ROOT from cpx config if not already set
+	if err := client.SetupEnv(); err != nil {
+		return err
+	}
+
+	projectName := build.GetProjectNameFromCMakeLists()
+	if projectName == "" {
+		return fmt.Errorf("failed to get project name from CMakeLists.txt")
+	}
+
+	if jobs <= 0 || jobs > len(sanitizers) {
+		jobs = len(sanitizers)
+	}
+
+	fmt.Printf("%s Running %d sanitizer flavor(s) in parallel (max %d at a time)...%s\n\n", Cyan, len(sanitizers), jobs, Reset)
+
+	var outputMu sync.Mutex
+	var wg sync.WaitGroup
+	sem := make(chan struct{}, jobs)
+	results := make([]sanitizerResult, len(sanitizers))
+	start := time.Now()
+
+	for i, sanitizer := range sanitizers {
+		wg.Add(1)
+		go func(i int, sanitizer string) {
+			defer wg.Done()
+			sem <- struct{}{}
+			defer func() { <-sem }()
+
+			out := newPrefixWriter(&outputMu, os.Stdout, sanitizer, prefixPalette[i%len(prefixPalette)])
+			passStart := time.Now()
+			findings, err := runSanitizerPass(sanitizer, projectName, filter, verbose, out)
+			out.Flush()
+
+			results[i] = sanitizerResult{sanitizer: sanitizer, duration: time.Since(passStart), findings: findings, err: err}
+		}(i, sanitizer)
+	}
+	wg.Wait()
+
+	// Summary table in flag order, then deduplicated findings
+	fmt.Printf("\n%sSummary%s %s(total: %s)%s\n", Cyan, Reset, Dim, time.Since(start).Round(time.Second), Reset)
+	failed := 0
+	for _, result := range results {
+		status := Green + IconSuccess + " ok" + Reset
+		if result.err != nil {
+			status = Red + IconError + " failed" + Reset
+			failed++
+		}
+		fmt.Printf("  %-12s %10s  %s\n", result.sanitizer, result.duration.Round(time.Second), status)
+		if result.err != nil {
+			fmt.Printf("    %s%v%s\n", Dim, result.err, Reset)
+		}
+	}
+
+	findings := dedupeFindings(results)
+	if len(findings) > 0 {
+		fmt.Printf("\n%sFindings (%d unique)%s\n", Yellow, len(findings), Reset)
+		for _, finding := range findings {
+			fmt.Printf("  %s•%s %s\n", Yellow, Reset, finding)
+		}
+	}
+
+	if failed > 0 {
+		return fmt.Errorf("%d of %d sanitizer flavor(s) failed", failed, len(sanitizers))
+	}
+	fmt.Printf("\n%s All sanitizer flavors passed!%s\n", Green, Reset)
+	return nil
+}
+
+// sanitizerResult is one row of the post-run summary table
+type sanitizerResult struct {
+	sanitizer string
+	duration  time.Duration
+	findings  []string
+	err       error
+}
+
+// parseSanitizerList validates the comma-separated --sanitizers value,
+// preserving the canonical order and dropping duplicates
+func parseSanitizerList(value string) ([]string, error) {
+	requested := make(map[string]bool)
+	for _, sanitizer := range strings.Split(value, ",") {
+		sanitizer = strings.TrimSpace(sanitizer)
+		if sanitizer == "" {
+			continue
+		}
+		known := false
+		for _, k := range knownSanitizers {
+			if sanitizer == k {
+				known = true
+				break
+			}
+		}
+		if !known {
+			return nil, fmt.Errorf("invalid sanitizer '%s' (expected one of: %s)", sanitizer, strings.Join(knownSanitizers, ", "))
+		}
+		requested[sanitizer] = true
+	}
+	if len(requested) == 0 {
+		return nil, fmt.Errorf("no sanitizers selected")
+	}
+
+	var sanitizers []string
+	for _, k := range knownSanitizers {
+		if requested[k] {
+			sanitizers = append(sanitizers, k)
+		}
+	}
+	return sanitizers, nil
+}
+
+// runSanitizerPass configures, builds and tests one sanitizer flavor in its
+// own build directory, streaming output to out and returning any sanitizer
+// findings extracted from the test logs
+func runSanitizerPass(sanitizer, projectName, filter string, verbose bool, out io.Writer) ([]string, error) {
+	cxxFlags, linkerFlags := build.GetSanitizerFlags(sanitizer)
+	buildDir := filepath.Join(".cache", "native", build.VariantDirName(false, "", sanitizer))
+
+	// Configure if this flavor's tree is cold
+	if _, err := os.Stat(filepath.Join(buildDir, "CMakeCache.txt")); os.IsNotExist(err) {
+		cwd, _ := os.Getwd()
+		vcpkgInstallArg := "-DVCPKG_INSTALLED_DIR=" + filepath.Join(cwd, ".cache", "native", "vcpkg_installed")
+
+		// Use the "default" preset if one exists, mirroring the test runner
+		var cmdArgs []string
+		if _, err := os.Stat("CMakePresets.json"); err == nil {
+			cmdArgs = []string{"--preset=default", "-B", buildDir, vcpkgInstallArg}
+		} else {
+			cmdArgs = []string{"-B", buildDir, "-DCMAKE_BUILD_TYPE=Debug", vcpkgInstallArg}
+		}
+		cmdArgs = append(cmdArgs,
+			"-DCMAKE_CXX_FLAGS="+cxxFlags, "-DCMAKE_C_FLAGS="+cxxFlags,
+			"-DCMAKE_EXE_LINKER_FLAGS="+linkerFlags, "-DCMAKE_SHARED_LINKER_FLAGS="+linkerFlags)
+
+		fmt.Fprintf(out, "Configuring %s...\n", buildDir)
+		configureCmd := execCommand("cmake", cmdArgs...)
+		configureCmd.Env = os.Environ()
+		if verbose {
+			configureCmd.Stdout = out
+		}
+		configureCmd.Stderr = out
+		if err := configureCmd.Run(); err != nil {
+			return nil, fmt.Errorf("cmake configure failed: %w", err)
+		}
+	}
+
+	fmt.Fprintf(out, "Building...\n")
+	buildCmd := execCommand("cmake", "--build", buildDir)
+	if verbose {
+		buildCmd.Stdout = out
+	}
+	buildCmd.Stderr = out
+	if err := buildCmd.Run(); err != nil {
+		return nil, fmt.Errorf("build failed: %w", err)
+	}
+
+	fmt.Fprintf(out, "Running tests...\n")
+	ctestArgs := []string{"--test-dir", buildDir, "--output-on-failure"}
+	if filter != "" {
+		ctestArgs = append(ctestArgs, "-R", filter)
+	}
+
+	// Capture the test log as well as streaming it, so findings can be
+	// extracted and deduplicated for the summary
+	var testLog strings.Builder
+	ctestCmd := execCommand("ctest", ctestArgs...)
+	ctestCmd.Stdout = io.MultiWriter(out, &testLog)
+	ctestCmd.Stderr = io.MultiWriter(out, &testLog)
+
+	testErr := ctestCmd.Run()
+	findings := extractSanitizerFindings(testLog.String())
+	if testErr != nil {
+		return findings, fmt.Errorf("tests failed: %w", testErr)
+	}
+	return findings, nil
+}
+
+// extractSanitizerFindings pulls the one-line report summaries out of a test
+// log. Sanitizer runtimes print a "SUMMARY: <tool>: <kind> <location>" line
+// per report; UBSan additionally prints bare "runtime error:" lines.
+func extractSanitizerFindings(log string) []string {
+	seen := make(map[string]bool)
+	var findings []string
+	for _, line := range strings.Split(log, "\n") {
+		line = strings.TrimSpace(line)
+		isFinding := strings.HasPrefix(line, "SUMMARY: ") || strings.Contains(line, "runtime error:")
+		if !isFinding || seen[line] {
+			continue
+		}
+		seen[line] = true
+		findings = append(findings, line)
+	}
+	return findings
+}
+
+// dedupeFindings merges per-sanitizer findings, dropping repeats across
+// flavors while keeping first-seen order
+func dedupeFindings(results []sanitizerResult) []string {
+	seen := make(map[string]bool)
+	var findings []string
+	for _, result := range results {
+		for _, finding := range result.findings {
+			if seen[finding] {
+				continue
+			}
+			seen[finding] = true
+			findings = append(findings, finding)
+		}
+	}
+	return findings
+}
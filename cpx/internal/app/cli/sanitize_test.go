@@ -0,0 +1,78 @@
+package cli
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+)
+
+func TestParseSanitizerList(t *testing.T) {
+	tests := []struct {
+		name     string
+		value    string
+		expected []string
+		wantErr  bool
+	}{
+		{"Default set", "asan,tsan,ubsan", []string{"asan", "tsan", "ubsan"}, false},
+		{"Single sanitizer", "asan", []string{"asan"}, false},
+		{"Canonical order restored", "ubsan,asan", []string{"asan", "ubsan"}, false},
+		{"Duplicates dropped", "asan,asan,tsan", []string{"asan", "tsan"}, false},
+		{"Spaces trimmed", " asan , msan ", []string{"asan", "msan"}, false},
+		{"Invalid sanitizer", "asan,lsan", nil, true},
+		{"Empty list", "", nil, true},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			sanitizers, err := parseSanitizerList(tt.value)
+			if tt.wantErr {
+				assert.Error(t, err)
+			} else {
+				assert.NoError(t, err)
+				assert.Equal(t, tt.expected, sanitizers)
+			}
+		})
+	}
+}
+
+func TestExtractSanitizerFindings(t *testing.T) {
+	log := `1/3 Test #1: myapp_tests .................   Passed
+==1234==ERROR: AddressSanitizer: heap-use-after-free on address 0x60200000
+    #0 0x55e in main asan_example.cpp:10
+SUMMARY: AddressSanitizer: heap-use-after-free asan_example.cpp:10 in main
+SUMMARY: AddressSanitizer: heap-use-after-free asan_example.cpp:10 in main
+ubsan_example.cpp:7:15: runtime error: signed integer overflow
+2/3 Test #2: myapp ......................***Failed`
+
+	findings := extractSanitizerFindings(log)
+
+	assert.Equal(t, []string{
+		"SUMMARY: AddressSanitizer: heap-use-after-free asan_example.cpp:10 in main",
+		"ubsan_example.cpp:7:15: runtime error: signed integer overflow",
+	}, findings)
+}
+
+func TestExtractSanitizerFindings_CleanLog(t *testing.T) {
+	findings := extractSanitizerFindings("100% tests passed, 0 tests failed out of 3\n")
+	assert.Empty(t, findings)
+}
+
+func TestDedupeFindings(t *testing.T) {
+	results := []sanitizerResult{
+		{sanitizer: "asan", findings: []string{
+			"SUMMARY: AddressSanitizer: heap-use-after-free asan_example.cpp:10 in main",
+		}},
+		{sanitizer: "ubsan", findings: []string{
+			"ubsan_example.cpp:7:15: runtime error: signed integer overflow",
+			// Same report surfacing under a second flavor is reported once
+			"SUMMARY: AddressSanitizer: heap-use-after-free asan_example.cpp:10 in main",
+		}},
+	}
+
+	findings := dedupeFindings(results)
+
+	assert.Equal(t, []string{
+		"SUMMARY: AddressSanitizer: heap-use-after-free asan_example.cpp:10 in main",
+		"ubsan_example.cpp:7:15: runtime error: signed integer overflow",
+	}, findings)
+}
@@ -0,0 +1,195 @@
+package cli
+
+import (
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+
+	"github.com/ozacod/cpx/internal/app/cli/tui"
+	"github.com/ozacod/cpx/internal/pkg/build"
+)
+
+// buildTargetCache persists discovered build targets so the picker opens
+// without re-running build-system introspection; the stamp ties it to the
+// build files it was derived from
+type buildTargetCache struct {
+	Stamp   string       `json:"stamp"`
+	Targets []tui.Target `json:"targets"`
+}
+
+const buildTargetCacheFile = ".cache/cpx-targets.json"
+
+// buildFileStamp hashes the mtimes of the build files a project type reads,
+// so editing any of them invalidates the cached target list
+func buildFileStamp(projectType ProjectType) string {
+	var files []string
+	switch projectType {
+	case ProjectTypeBazel:
+		files = []string{"MODULE.bazel", "BUILD.bazel", "src/BUILD.bazel", "include/BUILD.bazel", "tests/BUILD.bazel", "bench/BUILD.bazel"}
+	case ProjectTypeMeson:
+		files = []string{"meson.build", "src/meson.build", "tests/meson.build", "bench/meson.build"}
+	default:
+		files = []string{"CMakeLists.txt", "tests/CMakeLists.txt", "bench/CMakeLists.txt"}
+	}
+
+	var parts []string
+	for _, file := range files {
+		if info, err := os.Stat(file); err == nil {
+			parts = append(parts, fmt.Sprintf("%s:%d", file, info.ModTime().UnixNano()))
+		}
+	}
+	return strings.Join(parts, ";")
+}
+
+// DiscoverBuildTargets lists the project's runnable targets from build-system
+// introspection (CMake File API, bazel query, meson introspect), served from
+// a cache invalidated by build-file mtimes
+func DiscoverBuildTargets(projectType ProjectType) ([]tui.Target, error) {
+	stamp := buildFileStamp(projectType)
+
+	if data, err := os.ReadFile(buildTargetCacheFile); err == nil && stamp != "" {
+		var cache buildTargetCache
+		if err := json.Unmarshal(data, &cache); err == nil && cache.Stamp == stamp && len(cache.Targets) > 0 {
+			return cache.Targets, nil
+		}
+	}
+
+	var targets []tui.Target
+	var err error
+	switch projectType {
+	case ProjectTypeBazel:
+		targets, err = discoverBazelTargets()
+	case ProjectTypeMeson:
+		targets, err = discoverMesonTargets()
+	default:
+		targets, err = discoverCMakeTargets()
+	}
+	if err != nil {
+		return nil, err
+	}
+
+	sort.Slice(targets, func(i, j int) bool { return targets[i].Name < targets[j].Name })
+
+	// Cache write failures are non-fatal; next invocation re-introspects
+	if stamp != "" && len(targets) > 0 {
+		if data, err := json.MarshalIndent(buildTargetCache{Stamp: stamp, Targets: targets}, "", "  "); err == nil {
+			if err := os.MkdirAll(filepath.Dir(buildTargetCacheFile), 0755); err == nil {
+				_ = os.WriteFile(buildTargetCacheFile, data, 0644)
+			}
+		}
+	}
+
+	return targets, nil
+}
+
+// discoverCMakeTargets reads executable targets from the File API manifest of
+// any configured build variant
+func discoverCMakeTargets() ([]tui.Target, error) {
+	variantsDir := filepath.Join(".cache", "native")
+	entries, err := os.ReadDir(variantsDir)
+	if err != nil {
+		return nil, fmt.Errorf("no configured build found\n  hint: run 'cpx build' once so CMake can report its targets")
+	}
+
+	for _, entry := range entries {
+		if !entry.IsDir() {
+			continue
+		}
+		buildDir := filepath.Join(variantsDir, entry.Name())
+		if _, err := os.Stat(filepath.Join(buildDir, "CMakeCache.txt")); err != nil {
+			continue
+		}
+
+		manifest, ok := build.LoadTargetManifest(buildDir)
+		if !ok {
+			if manifest, err = build.RefreshTargetManifest(buildDir); err != nil {
+				continue
+			}
+		}
+
+		var targets []tui.Target
+		for name := range manifest.Targets {
+			targets = append(targets, tui.Target{Name: name, Platform: "executable (" + entry.Name() + ")"})
+		}
+		if len(targets) > 0 {
+			return targets, nil
+		}
+	}
+
+	return nil, fmt.Errorf("no executable targets found\n  hint: run 'cpx build' once so CMake can report its targets")
+}
+
+// discoverBazelTargets asks bazel query for the binary targets
+func discoverBazelTargets() ([]tui.Target, error) {
+	queryCmd := execCommand("bazel", "query", "kind(cc_binary, //...)", "--output=label")
+	output, err := queryCmd.Output()
+	if err != nil {
+		return nil, fmt.Errorf("bazel query failed: %w", err)
+	}
+
+	var targets []tui.Target
+	for _, line := range strings.Split(strings.TrimSpace(string(output)), "\n") {
+		label := strings.TrimSpace(line)
+		if label == "" {
+			continue
+		}
+		targets = append(targets, tui.Target{Name: label, Platform: "cc_binary"})
+	}
+	if len(targets) == 0 {
+		return nil, fmt.Errorf("no cc_binary targets found")
+	}
+	return targets, nil
+}
+
+// discoverMesonTargets asks meson introspect for the executable targets
+func discoverMesonTargets() ([]tui.Target, error) {
+	introspectCmd := execCommand("meson", "introspect", "builddir", "--targets")
+	output, err := introspectCmd.Output()
+	if err != nil {
+		return nil, fmt.Errorf("meson introspect failed (is builddir configured?): %w", err)
+	}
+	return parseMesonTargets(output)
+}
+
+// parseMesonTargets extracts executables from `meson introspect --targets`
+func parseMesonTargets(data []byte) ([]tui.Target, error) {
+	var entries []struct {
+		Name string `json:"name"`
+		Type string `json:"type"`
+	}
+	if err := json.Unmarshal(data, &entries); err != nil {
+		return nil, fmt.Errorf("failed to parse meson introspect output: %w", err)
+	}
+
+	var targets []tui.Target
+	for _, entry := range entries {
+		if entry.Type == "executable" {
+			targets = append(targets, tui.Target{Name: entry.Name, Platform: "executable"})
+		}
+	}
+	if len(targets) == 0 {
+		return nil, fmt.Errorf("no executable targets found")
+	}
+	return targets, nil
+}
+
+// PickBuildTarget opens the target chooser fed from introspection and
+// returns the chosen target name ("" when the user cancels)
+func PickBuildTarget(projectType ProjectType) (string, error) {
+	targets, err := DiscoverBuildTargets(projectType)
+	if err != nil {
+		return "", err
+	}
+
+	selected, err := tui.RunTargetSelection(targets, nil, "Select Target to Run")
+	if err != nil {
+		return "", fmt.Errorf("TUI error: %w", err)
+	}
+	if len(selected) == 0 {
+		return "", nil
+	}
+	return selected[0], nil
+}
@@ -0,0 +1,80 @@
+package cli
+
+import (
+	"encoding/json"
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/ozacod/cpx/internal/app/cli/tui"
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestParseMesonTargets(t *testing.T) {
+	data := []byte(`[
+		{"name": "myapp", "type": "executable"},
+		{"name": "myapp_lib", "type": "static library"},
+		{"name": "myapp_tests", "type": "executable"}
+	]`)
+
+	targets, err := parseMesonTargets(data)
+	require.NoError(t, err)
+	require.Len(t, targets, 2)
+	assert.Equal(t, "myapp", targets[0].Name)
+	assert.Equal(t, "myapp_tests", targets[1].Name)
+
+	_, err = parseMesonTargets([]byte(`[]`))
+	assert.Error(t, err)
+
+	_, err = parseMesonTargets([]byte(`not json`))
+	assert.Error(t, err)
+}
+
+func TestDiscoverBuildTargets_ServedFromCache(t *testing.T) {
+	tmpDir := t.TempDir()
+	oldWd, err := os.Getwd()
+	require.NoError(t, err)
+	defer os.Chdir(oldWd)
+	require.NoError(t, os.Chdir(tmpDir))
+
+	require.NoError(t, os.WriteFile("CMakeLists.txt", []byte("project(demo)"), 0644))
+
+	cache := buildTargetCache{
+		Stamp:   buildFileStamp(ProjectTypeVcpkg),
+		Targets: []tui.Target{{Name: "demo", Platform: "executable (debug)"}},
+	}
+	data, err := json.Marshal(cache)
+	require.NoError(t, err)
+	require.NoError(t, os.MkdirAll(filepath.Dir(buildTargetCacheFile), 0755))
+	require.NoError(t, os.WriteFile(buildTargetCacheFile, data, 0644))
+
+	targets, err := DiscoverBuildTargets(ProjectTypeVcpkg)
+	require.NoError(t, err)
+	require.Len(t, targets, 1)
+	assert.Equal(t, "demo", targets[0].Name)
+}
+
+func TestDiscoverBuildTargets_StaleCacheIgnored(t *testing.T) {
+	tmpDir := t.TempDir()
+	oldWd, err := os.Getwd()
+	require.NoError(t, err)
+	defer os.Chdir(oldWd)
+	require.NoError(t, os.Chdir(tmpDir))
+
+	require.NoError(t, os.WriteFile("CMakeLists.txt", []byte("project(demo)"), 0644))
+
+	cache := buildTargetCache{
+		Stamp:   "stale",
+		Targets: []tui.Target{{Name: "demo", Platform: "executable (debug)"}},
+	}
+	data, err := json.Marshal(cache)
+	require.NoError(t, err)
+	require.NoError(t, os.MkdirAll(filepath.Dir(buildTargetCacheFile), 0755))
+	require.NoError(t, os.WriteFile(buildTargetCacheFile, data, 0644))
+
+	// Stale stamp forces re-introspection, which fails without a configured
+	// build tree
+	_, err = DiscoverBuildTargets(ProjectTypeVcpkg)
+	assert.Error(t, err)
+}
@@ -3,6 +3,7 @@ package cli
 import (
 	"fmt"
 	"os"
+	"runtime"
 
 	"github.com/ozacod/cpx/internal/pkg/build"
 	"github.com/ozacod/cpx/internal/pkg/vcpkg"
@@ -15,9 +16,12 @@ func TestCmd(client *vcpkg.Client) *cobra.Command {
 		Use:   "test",
 		Short: "Build and run tests",
 		Long:  "Build the project tests and run them. Detects vcpkg/CMake or Bazel projects automatically.",
-		Example: `  cpx test                 # Build + run all tests
+		Example: `  cpx test                 # Build + run all tests (parallel by default)
   cpx test --verbose       # Show verbose output
-  cpx test --filter MySuite.*`,
+  cpx test --filter MySuite.*
+  cpx test --sanitizer asan  # Reuse the warm asan build tree
+  cpx test -j 4              # Limit test parallelism
+  cpx test --shard 0 --shards 4  # Run shard 1 of 4 (GoogleTest, for CI fan-out)`,
 		RunE: func(cmd *cobra.Command, args []string) error {
 			return runTest(cmd, args, client)
 		},
@@ -25,6 +29,11 @@ func TestCmd(client *vcpkg.Client) *cobra.Command {
 
 	cmd.Flags().BoolP("verbose", "v", false, "Show verbose test output")
 	cmd.Flags().String("filter", "", "Filter tests by name (ctest regex or bazel target)")
+	cmd.Flags().BoolP("release", "r", false, "Test the release configuration (CMake/vcpkg projects)")
+	cmd.Flags().String("sanitizer", "", "Test with sanitizer: asan, tsan, ubsan, msan (CMake/vcpkg projects)")
+	cmd.Flags().IntP("jobs", "j", 0, "Parallel test jobs (0 = all cores)")
+	cmd.Flags().Int("shards", 0, "Split GoogleTest binaries into this many shards (GTEST_TOTAL_SHARDS)")
+	cmd.Flags().Int("shard", 0, "Which shard to run on this machine, 0-based (GTEST_SHARD_INDEX)")
 
 	return cmd
 }
@@ -32,22 +41,34 @@ func TestCmd(client *vcpkg.Client) *cobra.Command {
 func runTest(cmd *cobra.Command, args []string, client *vcpkg.Client) error {
 	verbose, _ := cmd.Flags().GetBool("verbose")
 	filter, _ := cmd.Flags().GetString("filter")
+	release, _ := cmd.Flags().GetBool("release")
+	sanitizer, _ := cmd.Flags().GetString("sanitizer")
+	jobs, _ := cmd.Flags().GetInt("jobs")
+	shards, _ := cmd.Flags().GetInt("shards")
+	shard, _ := cmd.Flags().GetInt("shard")
+
+	if shards > 0 && (shard < 0 || shard >= shards) {
+		return fmt.Errorf("--shard must be between 0 and %d (got %d)", shards-1, shard)
+	}
+	if shards == 0 && shard != 0 {
+		return fmt.Errorf("--shard requires --shards")
+	}
 
 	// Detect project type
 	projectType := DetectProjectType()
 
 	switch projectType {
 	case ProjectTypeBazel:
-		return runBazelTest(verbose, filter)
+		return runBazelTest(verbose, filter, jobs, shard, shards)
 	case ProjectTypeMeson:
-		return runMesonTest(verbose, filter)
+		return runMesonTest(verbose, filter, jobs, shard, shards)
 	default:
 		// CMake/vcpkg
-		return build.RunTests(verbose, filter, client)
+		return build.RunTests(verbose, filter, release, sanitizer, jobs, shard, shards, client)
 	}
 }
 
-func runBazelTest(verbose bool, filter string) error {
+func runBazelTest(verbose bool, filter string, jobs int, shard int, shards int) error {
 	fmt.Printf("%sRunning Bazel tests...%s\n", Cyan, Reset)
 
 	bazelArgs := []string{"test"}
@@ -59,6 +80,18 @@ func runBazelTest(verbose bool, filter string) error {
 		bazelArgs = append(bazelArgs, "//...")
 	}
 
+	if jobs > 0 {
+		bazelArgs = append(bazelArgs, fmt.Sprintf("--jobs=%d", jobs))
+	}
+
+	// GoogleTest sharding for CI fan-out: each machine runs one slice of the
+	// big test binaries (bazel's own shard_count covers per-target sharding)
+	if shards > 0 {
+		bazelArgs = append(bazelArgs,
+			fmt.Sprintf("--test_env=GTEST_TOTAL_SHARDS=%d", shards),
+			fmt.Sprintf("--test_env=GTEST_SHARD_INDEX=%d", shard))
+	}
+
 	// Add verbose flag
 	if verbose {
 		bazelArgs = append(bazelArgs, "--test_output=all")
@@ -80,13 +113,13 @@ func runBazelTest(verbose bool, filter string) error {
 	return nil
 }
 
-func runMesonTest(verbose bool, filter string) error {
+func runMesonTest(verbose bool, filter string, jobs int, shard int, shards int) error {
 	fmt.Printf("%sRunning Meson tests...%s\n", Cyan, Reset)
 
 	// Ensure builddir exists
 	if _, err := os.Stat("builddir"); os.IsNotExist(err) {
 		// Need to setup first
-		if err := runMesonBuild(false, "", false, verbose, "", ""); err != nil {
+		if err := runMesonBuild(false, "", false, verbose, "", "", false, "", "", false, false); err != nil {
 			return fmt.Errorf("build failed: %w", err)
 		}
 	}
@@ -100,6 +133,12 @@ func runMesonTest(verbose bool, filter string) error {
 	mesonArgs = append(mesonArgs, "--no-suite", "gmock")
 	mesonArgs = append(mesonArgs, "--no-suite", "catch2")
 
+	// Fan tests out across cores (meson defaults to serial in some setups)
+	if jobs == 0 {
+		jobs = runtime.NumCPU()
+	}
+	mesonArgs = append(mesonArgs, "-j", fmt.Sprintf("%d", jobs))
+
 	if verbose {
 		mesonArgs = append(mesonArgs, "-v")
 	} else {
@@ -111,6 +150,12 @@ func runMesonTest(verbose bool, filter string) error {
 	}
 
 	testCmd := execCommand("meson", mesonArgs...)
+	// GoogleTest binaries pick up the shard slice from the environment
+	if shards > 0 {
+		testCmd.Env = append(os.Environ(),
+			fmt.Sprintf("GTEST_TOTAL_SHARDS=%d", shards),
+			fmt.Sprintf("GTEST_SHARD_INDEX=%d", shard))
+	}
 	testCmd.Stdout = os.Stdout
 	testCmd.Stderr = os.Stderr
 
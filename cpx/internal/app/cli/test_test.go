@@ -31,6 +31,9 @@ func TestRunBazelTest(t *testing.T) {
 		name       string
 		verbose    bool
 		filter     string
+		jobs       int
+		shard      int
+		shards     int
 		wantOutput string
 	}{
 		{
@@ -51,12 +54,27 @@ func TestRunBazelTest(t *testing.T) {
 			filter:     "//tests:unit_test",
 			wantOutput: "//tests:unit_test",
 		},
+		{
+			name:       "Limit parallel jobs",
+			verbose:    false,
+			filter:     "",
+			jobs:       4,
+			wantOutput: "--jobs=4",
+		},
+		{
+			name:       "GoogleTest sharding",
+			verbose:    false,
+			filter:     "",
+			shard:      1,
+			shards:     4,
+			wantOutput: "--test_env=GTEST_TOTAL_SHARDS=4",
+		},
 	}
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
 			capturedArgs = nil
-			err := runBazelTest(tt.verbose, tt.filter)
+			err := runBazelTest(tt.verbose, tt.filter, tt.jobs, tt.shard, tt.shards)
 			assert.NoError(t, err)
 
 			require.GreaterOrEqual(t, len(capturedArgs), 1)
@@ -64,6 +82,9 @@ func TestRunBazelTest(t *testing.T) {
 			assert.Equal(t, "bazel", capturedArgs[0][0])
 			assert.Equal(t, "test", capturedArgs[0][1])
 			assert.Contains(t, capturedArgs[0], tt.wantOutput)
+			if tt.shards > 0 {
+				assert.Contains(t, capturedArgs[0], "--test_env=GTEST_SHARD_INDEX=1")
+			}
 		})
 	}
 }
@@ -122,7 +143,7 @@ func TestRunMesonTest(t *testing.T) {
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
 			capturedArgs = nil
-			err := runMesonTest(tt.verbose, tt.filter)
+			err := runMesonTest(tt.verbose, tt.filter, 2, 0, 0)
 			assert.NoError(t, err)
 
 			require.GreaterOrEqual(t, len(capturedArgs), 1)
@@ -131,6 +152,8 @@ func TestRunMesonTest(t *testing.T) {
 			for _, args := range capturedArgs {
 				if len(args) >= 2 && args[0] == "meson" && args[1] == "test" {
 					found = true
+					assert.Contains(t, args, "-j")
+					assert.Contains(t, args, "2")
 					if tt.verbose {
 						assert.Contains(t, args, "-v")
 					} else {
@@ -0,0 +1,184 @@
+package tui
+
+import (
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"sync"
+)
+
+// PackageIndex is a compact serialized index of the vcpkg ports tree
+// (names, versions, descriptions). It is built once by scanning the port
+// manifests, persisted under ~/.cache/cpx/, and refreshed only when the
+// ports tree changes — so search queries never touch the (possibly
+// NFS-mounted) vcpkg root.
+type PackageIndex struct {
+	// Stamp identifies the ports tree state the index was built from
+	Stamp    string         `json:"stamp"`
+	Packages []SearchResult `json:"packages"`
+}
+
+// In-process cache so repeated queries in one TUI session reuse the loaded
+// index without re-reading it from disk
+var (
+	indexMu    sync.Mutex
+	indexCache = make(map[string]*PackageIndex)
+)
+
+// indexPath returns where the serialized index for a vcpkg root lives
+func indexPath(vcpkgRoot string) (string, error) {
+	homeDir, err := os.UserHomeDir()
+	if err != nil {
+		return "", fmt.Errorf("failed to get home directory: %w", err)
+	}
+	// Key the file by root so multiple vcpkg checkouts don't collide
+	sum := sha256.Sum256([]byte(vcpkgRoot))
+	name := "vcpkg-index-" + hex.EncodeToString(sum[:8]) + ".json"
+	return filepath.Join(homeDir, ".cache", "cpx", name), nil
+}
+
+// portsStamp fingerprints the ports tree. A git checkout (the normal case)
+// is identified by the commit HEAD points at, so any update of the vcpkg
+// tree — including in-place edits to existing port manifests — rebuilds the
+// index. A plain directory falls back to the ports dir mtime plus entry
+// count, which only tracks ports being added or removed, not edited.
+func portsStamp(vcpkgRoot string, portsDir string) (string, error) {
+	headPath := filepath.Join(vcpkgRoot, ".git", "HEAD")
+	if data, err := os.ReadFile(headPath); err == nil {
+		head := strings.TrimSpace(string(data))
+		if ref, ok := strings.CutPrefix(head, "ref: "); ok {
+			if refData, err := os.ReadFile(filepath.Join(vcpkgRoot, ".git", ref)); err == nil {
+				return strings.TrimSpace(string(refData)), nil
+			}
+		}
+		return head, nil
+	}
+
+	info, err := os.Stat(portsDir)
+	if err != nil {
+		return "", fmt.Errorf("failed to stat ports directory: %w", err)
+	}
+	entries, err := os.ReadDir(portsDir)
+	if err != nil {
+		return "", fmt.Errorf("failed to read ports directory: %w", err)
+	}
+	return fmt.Sprintf("%d-%d", info.ModTime().UnixNano(), len(entries)), nil
+}
+
+// LoadPackageIndex returns the index for a vcpkg root, using (in order) the
+// in-process cache, the serialized index on disk, or a fresh scan of the
+// ports tree when the stamp shows it changed.
+func LoadPackageIndex(vcpkgRoot string) (*PackageIndex, error) {
+	portsDir := filepath.Join(vcpkgRoot, "ports")
+	stamp, err := portsStamp(vcpkgRoot, portsDir)
+	if err != nil {
+		return nil, err
+	}
+
+	indexMu.Lock()
+	defer indexMu.Unlock()
+
+	if idx, ok := indexCache[vcpkgRoot]; ok && idx.Stamp == stamp {
+		return idx, nil
+	}
+
+	path, err := indexPath(vcpkgRoot)
+	if err != nil {
+		return nil, err
+	}
+
+	// Try the serialized index on disk
+	if data, err := os.ReadFile(path); err == nil {
+		var idx PackageIndex
+		if err := json.Unmarshal(data, &idx); err == nil && idx.Stamp == stamp {
+			indexCache[vcpkgRoot] = &idx
+			return &idx, nil
+		}
+	}
+
+	// Stale or missing: rebuild from the ports tree
+	idx, err := buildPackageIndex(portsDir, stamp)
+	if err != nil {
+		return nil, err
+	}
+
+	// Persist for the next session; failure to write is not fatal
+	if data, err := json.Marshal(idx); err == nil {
+		if err := os.MkdirAll(filepath.Dir(path), 0755); err == nil {
+			os.WriteFile(path, data, 0644)
+		}
+	}
+
+	indexCache[vcpkgRoot] = idx
+	return idx, nil
+}
+
+// buildPackageIndex scans every port manifest once and collects name,
+// version and description
+func buildPackageIndex(portsDir string, stamp string) (*PackageIndex, error) {
+	entries, err := os.ReadDir(portsDir)
+	if err != nil {
+		return nil, fmt.Errorf("failed to read ports directory: %w", err)
+	}
+
+	idx := &PackageIndex{Stamp: stamp}
+	for _, entry := range entries {
+		if !entry.IsDir() {
+			continue
+		}
+
+		name := entry.Name()
+		// Skip vcpkg internal packages
+		if strings.HasPrefix(name, "vcpkg-") {
+			continue
+		}
+
+		manifestPath := filepath.Join(portsDir, name, "vcpkg.json")
+		data, err := os.ReadFile(manifestPath)
+		if err != nil {
+			// Skip ports without vcpkg.json
+			continue
+		}
+
+		var manifest portManifest
+		if err := json.Unmarshal(data, &manifest); err != nil {
+			// Skip invalid manifests
+			continue
+		}
+
+		idx.Packages = append(idx.Packages, SearchResult{
+			Name:        manifest.Name,
+			Version:     manifest.getVersion(),
+			Description: manifest.getDescription(),
+		})
+	}
+
+	return idx, nil
+}
+
+// Search returns packages whose name contains the query, prefix matches
+// first, each group in alphabetical order
+func (idx *PackageIndex) Search(query string) []SearchResult {
+	queryLower := strings.ToLower(query)
+
+	var prefix, substring []SearchResult
+	for _, pkg := range idx.Packages {
+		nameLower := strings.ToLower(pkg.Name)
+		switch {
+		case strings.HasPrefix(nameLower, queryLower):
+			prefix = append(prefix, pkg)
+		case strings.Contains(nameLower, queryLower):
+			substring = append(substring, pkg)
+		}
+	}
+
+	sort.Slice(prefix, func(i, j int) bool { return prefix[i].Name < prefix[j].Name })
+	sort.Slice(substring, func(i, j int) bool { return substring[i].Name < substring[j].Name })
+
+	return append(prefix, substring...)
+}
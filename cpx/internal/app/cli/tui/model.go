@@ -16,9 +16,12 @@ type Step int
 const (
 	StepProjectName Step = iota
 	StepProjectType
+	StepPerfCore
+	StepSimd
 	StepCppStandard
 	StepTestFramework
 	StepBenchmark
+	StepPch
 	StepClangFormat
 	StepPackageManager
 	StepGitHooks
@@ -39,9 +42,12 @@ type Question struct {
 type ProjectConfig struct {
 	Name           string
 	IsLibrary      bool
+	PerfCore       bool
+	Simd           bool
 	CppStandard    int
 	TestFramework  string
 	Benchmark      string
+	UsePch         bool
 	ClangFormat    string
 	PackageManager string // "vcpkg" or "none"
 	VCS            string // "git" or "none"
@@ -253,6 +259,40 @@ func (m Model) handleEnter() (tea.Model, tea.Cmd) {
 			Complete: true,
 		})
 
+		m.currentQuestion = "Include a high-performance core (arena, small_vector, ring_buffer)?"
+		m.step = StepPerfCore
+		m.cursor = 1 // Default to No
+
+	case StepPerfCore:
+		m.config.PerfCore = m.cursor == 0
+		answer := "Yes"
+		if !m.config.PerfCore {
+			answer = "No"
+		}
+
+		m.questions = append(m.questions, Question{
+			Question: m.currentQuestion,
+			Answer:   answer,
+			Complete: true,
+		})
+
+		m.currentQuestion = "Include a SIMD kernel scaffold with runtime dispatch?"
+		m.step = StepSimd
+		m.cursor = 1 // Default to No
+
+	case StepSimd:
+		m.config.Simd = m.cursor == 0
+		answer := "Yes"
+		if !m.config.Simd {
+			answer = "No"
+		}
+
+		m.questions = append(m.questions, Question{
+			Question: m.currentQuestion,
+			Answer:   answer,
+			Complete: true,
+		})
+
 		m.currentQuestion = "Which C++ standard would you like to use?"
 		m.step = StepCppStandard
 		m.cursor = 2 // Default to C++17
@@ -297,6 +337,23 @@ func (m Model) handleEnter() (tea.Model, tea.Cmd) {
 			Complete: true,
 		})
 
+		m.currentQuestion = "Generate a precompiled header (pch.hpp)?"
+		m.step = StepPch
+		m.cursor = 0
+
+	case StepPch:
+		m.config.UsePch = m.cursor == 0
+		answer := "Yes"
+		if !m.config.UsePch {
+			answer = "No"
+		}
+
+		m.questions = append(m.questions, Question{
+			Question: m.currentQuestion,
+			Answer:   answer,
+			Complete: true,
+		})
+
 		m.currentQuestion = "Which clang-format style would you like?"
 		m.step = StepClangFormat
 		m.cursor = 0
@@ -447,6 +504,12 @@ func (m Model) getMaxCursor() int {
 		return len(m.clangFormatOptions) - 1
 	case StepBenchmark:
 		return len(m.benchmarkOptions) - 1
+	case StepPerfCore:
+		return 1 // Yes or No
+	case StepSimd:
+		return 1 // Yes or No
+	case StepPch:
+		return 1 // Yes or No
 	case StepPackageManager:
 		return len(m.packageManagerOptions) - 1
 	case StepGitHooks:
@@ -523,6 +586,16 @@ func (m Model) View() string {
 				s.WriteString(fmt.Sprintf("  %s %s\n", cursor, opt))
 			}
 
+		case StepPerfCore, StepSimd:
+			answer := "Yes"
+			if m.cursor == 1 {
+				answer = "No"
+			}
+			s.WriteString(dimStyle.Render(answer))
+			s.WriteString("\n")
+			s.WriteString(fmt.Sprintf("  %s Yes\n", m.renderCursor(0)))
+			s.WriteString(fmt.Sprintf("  %s No\n", m.renderCursor(1)))
+
 		case StepCppStandard:
 			s.WriteString(dimStyle.Render(fmt.Sprintf("C++%d", m.cppStandardOptions[m.cursor])))
 			s.WriteString("\n")
@@ -556,6 +629,16 @@ func (m Model) View() string {
 				s.WriteString(fmt.Sprintf("  %s %s\n", cursor, b))
 			}
 
+		case StepPch:
+			answer := "Yes"
+			if m.cursor == 1 {
+				answer = "No"
+			}
+			s.WriteString(dimStyle.Render(answer))
+			s.WriteString("\n")
+			s.WriteString(fmt.Sprintf("  %s Yes\n", m.renderCursor(0)))
+			s.WriteString(fmt.Sprintf("  %s No\n", m.renderCursor(1)))
+
 		case StepClangFormat:
 			s.WriteString(dimStyle.Render(m.clangFormatOptions[m.cursor]))
 			s.WriteString("\n")
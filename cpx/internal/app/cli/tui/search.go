@@ -2,9 +2,7 @@ package tui
 
 import (
 	"bytes"
-	"encoding/json"
 	"fmt"
-	"os"
 	"os/exec"
 	"path/filepath"
 	"strings"
@@ -160,53 +158,13 @@ func (p portManifest) getDescription() string {
 
 func (m SearchModel) doSearch() tea.Cmd {
 	return func() tea.Msg {
-		portsDir := filepath.Join(m.vcpkgRoot, "ports")
-		entries, err := os.ReadDir(portsDir)
+		// Queries are served from the serialized package index; the ports
+		// tree is only touched when the index needs a rebuild
+		idx, err := LoadPackageIndex(m.vcpkgRoot)
 		if err != nil {
-			return SearchResultsMsg{Err: fmt.Errorf("failed to read ports directory: %w", err)}
+			return SearchResultsMsg{Err: err}
 		}
-
-		queryLower := strings.ToLower(m.query)
-		var results []SearchResult
-
-		for _, entry := range entries {
-			if !entry.IsDir() {
-				continue
-			}
-
-			name := entry.Name()
-			// Skip vcpkg internal packages
-			if strings.HasPrefix(name, "vcpkg-") {
-				continue
-			}
-
-			// Quick name match first (before reading JSON)
-			if !strings.Contains(strings.ToLower(name), queryLower) {
-				continue
-			}
-
-			// Read vcpkg.json for this port
-			manifestPath := filepath.Join(portsDir, name, "vcpkg.json")
-			data, err := os.ReadFile(manifestPath)
-			if err != nil {
-				// Skip ports without vcpkg.json
-				continue
-			}
-
-			var manifest portManifest
-			if err := json.Unmarshal(data, &manifest); err != nil {
-				// Skip invalid manifests
-				continue
-			}
-
-			results = append(results, SearchResult{
-				Name:        manifest.Name,
-				Version:     manifest.getVersion(),
-				Description: manifest.getDescription(),
-			})
-		}
-
-		return SearchResultsMsg{Results: results}
+		return SearchResultsMsg{Results: idx.Search(m.query)}
 	}
 }
 
@@ -0,0 +1,117 @@
+package cli
+
+import (
+	"fmt"
+	"time"
+
+	"github.com/ozacod/cpx/internal/pkg/build"
+	"github.com/ozacod/cpx/internal/pkg/vcpkg"
+	"github.com/spf13/cobra"
+)
+
+// WatchCmd creates the watch command
+func WatchCmd(client *vcpkg.Client) *cobra.Command {
+	cmd := &cobra.Command{
+		Use:   "watch",
+		Short: "Watch the source tree and rebuild on change",
+		Long: `Watch the source tree, debounce change bursts, and drive a minimal
+incremental rebuild on each one — optionally followed by running the binary
+or the tests. Configure state stays warm between iterations, so each loop
+only pays for the compile itself.`,
+		Example: `  cpx watch              # Rebuild on every change
+  cpx watch --run        # Rebuild, then run the binary
+  cpx watch --test       # Rebuild, then run the tests
+  cpx watch --run -- --port 8080   # Args after -- go to the binary`,
+		RunE: func(cmd *cobra.Command, args []string) error {
+			return runWatch(cmd, args, client)
+		},
+	}
+
+	cmd.Flags().BoolP("release", "r", false, "Release build (-O2). Default is debug")
+	cmd.Flags().IntP("jobs", "j", 0, "Parallel jobs for build (0 = auto)")
+	cmd.Flags().String("target", "", "Specific target to build (and run with --run)")
+	cmd.Flags().StringP("opt", "O", "", "Override optimization level: 0,1,2,3,s,fast")
+	cmd.Flags().Bool("run", false, "Run the executable after each successful build")
+	cmd.Flags().Bool("test", false, "Run the tests after each successful build")
+	cmd.Flags().Duration("debounce", 500*time.Millisecond, "Quiet period before a change burst triggers a rebuild")
+	cmd.Flags().Bool("verbose", false, "Show full build output")
+
+	return cmd
+}
+
+func runWatch(cmd *cobra.Command, args []string, client *vcpkg.Client) error {
+	release, _ := cmd.Flags().GetBool("release")
+	jobs, _ := cmd.Flags().GetInt("jobs")
+	target, _ := cmd.Flags().GetString("target")
+	optLevel, _ := cmd.Flags().GetString("opt")
+	runAfter, _ := cmd.Flags().GetBool("run")
+	testAfter, _ := cmd.Flags().GetBool("test")
+	debounce, _ := cmd.Flags().GetDuration("debounce")
+	verbose, _ := cmd.Flags().GetBool("verbose")
+
+	if runAfter && testAfter {
+		return fmt.Errorf("--run and --test cannot be combined (pick one post-build action)")
+	}
+
+	projectType := DetectProjectType()
+
+	// One watch iteration: minimal incremental build, then the optional
+	// post-build action. RunProject and RunTests do their own incremental
+	// build first, so they are the whole step when --run/--test is given.
+	step := func() error {
+		switch projectType {
+		case ProjectTypeBazel:
+			if err := runBazelBuild(release, target, false, verbose, optLevel, "", "", "", false); err != nil {
+				return err
+			}
+			if testAfter {
+				return runBazelTest(verbose, "", jobs, 0, 0)
+			}
+			if runAfter {
+				return runBazelRun(release, target, args, verbose, optLevel, "")
+			}
+			return nil
+		case ProjectTypeMeson:
+			if err := runMesonBuild(release, target, false, verbose, optLevel, "", false, "", "", false, false); err != nil {
+				return err
+			}
+			if testAfter {
+				return runMesonTest(verbose, "", jobs, 0, 0)
+			}
+			if runAfter {
+				return runMesonRun(release, target, args, verbose, optLevel, "")
+			}
+			return nil
+		default:
+			if testAfter {
+				return build.RunTests(verbose, "", release, "", jobs, 0, 0, client)
+			}
+			if runAfter {
+				return build.RunProject(release, target, args, verbose, optLevel, "", client)
+			}
+			return build.BuildProject(release, jobs, target, false, optLevel, verbose, "", false, "", "", "", false, false, false, client)
+		}
+	}
+
+	config := build.DefaultWatchConfig()
+	config.Debounce = debounce
+
+	fmt.Printf("%s👀 Watching for changes (debounce %s)%s\n", Cyan, debounce, Reset)
+	fmt.Printf("%s   Press Ctrl+C to stop%s\n\n", Yellow, Reset)
+
+	// A failing iteration keeps the watch alive; the next save retries
+	if err := step(); err != nil {
+		fmt.Printf("%s✗ %v%s\n", Red, err, Reset)
+	}
+
+	return build.WatchChanges(config, func(changes []string) {
+		fmt.Printf("\n%s📝 Changes detected:%s\n", Cyan, Reset)
+		for _, change := range changes {
+			fmt.Printf("   %s\n", change)
+		}
+		fmt.Println()
+		if err := step(); err != nil {
+			fmt.Printf("%s✗ %v%s\n", Red, err, Reset)
+		}
+	})
+}
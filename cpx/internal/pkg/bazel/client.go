@@ -70,31 +70,33 @@ func (c *Client) ListModules() ([]string, error) {
 	return modules, nil
 }
 
-// SearchModules searches for modules by name pattern
+// SearchModules searches for modules by name pattern using the registry
+// index, so queries never re-walk the modules directory
 func (c *Client) SearchModules(query string) ([]Module, error) {
-	allModules, err := c.ListModules()
+	idx, err := c.loadIndex()
 	if err != nil {
 		return nil, err
 	}
+	return idx.search(query), nil
+}
 
-	query = strings.ToLower(query)
-	var results []Module
-
-	for _, name := range allModules {
-		if strings.Contains(strings.ToLower(name), query) {
-			module, err := c.GetModule(name)
-			if err != nil {
-				continue // Skip modules with metadata errors
-			}
-			results = append(results, *module)
+// GetModule fetches metadata for a specific module, served from the registry
+// index when available
+func (c *Client) GetModule(moduleName string) (*Module, error) {
+	if idx, err := c.loadIndex(); err == nil {
+		if module, ok := idx.lookup(moduleName); ok {
+			return module, nil
 		}
+		return nil, fmt.Errorf("module %s not found in registry", moduleName)
 	}
 
-	return results, nil
+	// Index unavailable (e.g. unreadable cache dir): read metadata directly
+	return c.readModuleMetadata(moduleName)
 }
 
-// GetModule fetches metadata for a specific module
-func (c *Client) GetModule(moduleName string) (*Module, error) {
+// readModuleMetadata reads and parses a module's metadata.json from the
+// registry checkout
+func (c *Client) readModuleMetadata(moduleName string) (*Module, error) {
 	metadataPath := filepath.Join(c.GetModulesDir(), moduleName, "metadata.json")
 
 	data, err := os.ReadFile(metadataPath)
@@ -150,24 +152,39 @@ func (c *Client) GetModuleVersions(moduleName string) ([]string, error) {
 
 // AddDependency adds a bazel_dep to MODULE.bazel
 func AddDependency(modulePath, depName, version string) error {
+	return AddDependencies(modulePath, []Dependency{{Name: depName, Version: version}})
+}
+
+// AddDependencies adds or updates several bazel_dep entries with a single
+// read-modify-write of MODULE.bazel, so batched installs touch the manifest
+// only once
+func AddDependencies(modulePath string, deps []Dependency) error {
 	content, err := os.ReadFile(modulePath)
 	if err != nil {
 		return fmt.Errorf("failed to read MODULE.bazel: %w", err)
 	}
 
+	for _, dep := range deps {
+		content = upsertDependency(content, dep.Name, dep.Version)
+	}
+
+	return os.WriteFile(modulePath, content, 0644)
+}
+
+// upsertDependency updates an existing bazel_dep entry in place or appends a
+// new one at the end
+func upsertDependency(content []byte, depName, version string) []byte {
 	// Check if dependency already exists
 	depPattern := regexp.MustCompile(fmt.Sprintf(`bazel_dep\s*\(\s*name\s*=\s*"%s"`, regexp.QuoteMeta(depName)))
 	if depPattern.Match(content) {
 		// Update existing dependency
 		updatePattern := regexp.MustCompile(fmt.Sprintf(`(bazel_dep\s*\(\s*name\s*=\s*"%s"\s*,\s*version\s*=\s*")[^"]*(")\)`, regexp.QuoteMeta(depName)))
-		newContent := updatePattern.ReplaceAll(content, []byte(fmt.Sprintf(`${1}%s${2})`, version)))
-		return os.WriteFile(modulePath, newContent, 0644)
+		return updatePattern.ReplaceAll(content, []byte(fmt.Sprintf(`${1}%s${2})`, version)))
 	}
 
 	// Add new dependency at the end
 	newDep := fmt.Sprintf("\nbazel_dep(name = \"%s\", version = \"%s\")\n", depName, version)
-	content = append(content, []byte(newDep)...)
-	return os.WriteFile(modulePath, content, 0644)
+	return append(content, []byte(newDep)...)
 }
 
 // ListDependencies returns current bazel_dep entries from MODULE.bazel
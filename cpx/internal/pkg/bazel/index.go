@@ -0,0 +1,185 @@
+package bazel
+
+import (
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"sync"
+)
+
+// registryIndex caches the metadata of every BCR module for one registry
+// revision, so module lookups and searches never walk the modules directory.
+// It is persisted under ~/.cache/cpx/ and invalidated when the registry's
+// git HEAD moves.
+type registryIndex struct {
+	Revision string   `json:"revision"`
+	Modules  []Module `json:"modules"` // sorted by name
+
+	byName map[string]*Module
+}
+
+var (
+	indexMu    sync.Mutex
+	indexCache = make(map[string]*registryIndex)
+)
+
+// registryRevision fingerprints the registry checkout. A git checkout is
+// identified by the commit HEAD points at; a plain directory falls back to
+// the modules dir mtime and entry count.
+func (c *Client) registryRevision() string {
+	headPath := filepath.Join(c.registryPath, ".git", "HEAD")
+	if data, err := os.ReadFile(headPath); err == nil {
+		head := strings.TrimSpace(string(data))
+		if ref, ok := strings.CutPrefix(head, "ref: "); ok {
+			if refData, err := os.ReadFile(filepath.Join(c.registryPath, ".git", ref)); err == nil {
+				return strings.TrimSpace(string(refData))
+			}
+		}
+		return head
+	}
+
+	info, err := os.Stat(c.GetModulesDir())
+	if err != nil {
+		return ""
+	}
+	entries, _ := os.ReadDir(c.GetModulesDir())
+	return fmt.Sprintf("%d-%d", info.ModTime().UnixNano(), len(entries))
+}
+
+// indexPath returns where the serialized index for this registry lives
+func (c *Client) indexPath() (string, error) {
+	homeDir, err := os.UserHomeDir()
+	if err != nil {
+		return "", fmt.Errorf("failed to get home directory: %w", err)
+	}
+	sum := sha256.Sum256([]byte(c.registryPath))
+	name := "bcr-index-" + hex.EncodeToString(sum[:8]) + ".json"
+	return filepath.Join(homeDir, ".cache", "cpx", name), nil
+}
+
+// loadIndex returns the registry index, using (in order) the in-process
+// cache, the serialized index on disk, or a full scan of the modules
+// directory when the registry revision changed.
+func (c *Client) loadIndex() (*registryIndex, error) {
+	revision := c.registryRevision()
+
+	indexMu.Lock()
+	defer indexMu.Unlock()
+
+	if idx, ok := indexCache[c.registryPath]; ok && idx.Revision == revision {
+		return idx, nil
+	}
+
+	path, err := c.indexPath()
+	if err != nil {
+		return nil, err
+	}
+
+	// Try the serialized index on disk
+	if data, err := os.ReadFile(path); err == nil {
+		var idx registryIndex
+		if err := json.Unmarshal(data, &idx); err == nil && idx.Revision == revision {
+			idx.buildLookup()
+			indexCache[c.registryPath] = &idx
+			return &idx, nil
+		}
+	}
+
+	// Stale or missing: rebuild by scanning every module's metadata once
+	idx, err := c.buildIndex(revision)
+	if err != nil {
+		return nil, err
+	}
+
+	// Persist for the next invocation; failure to write is not fatal
+	if data, err := json.Marshal(idx); err == nil {
+		if err := os.MkdirAll(filepath.Dir(path), 0755); err == nil {
+			os.WriteFile(path, data, 0644)
+		}
+	}
+
+	indexCache[c.registryPath] = idx
+	return idx, nil
+}
+
+// buildIndex scans the modules directory and reads every metadata.json
+func (c *Client) buildIndex(revision string) (*registryIndex, error) {
+	names, err := c.ListModules()
+	if err != nil {
+		return nil, err
+	}
+
+	idx := &registryIndex{Revision: revision}
+	for _, name := range names {
+		module, err := c.readModuleMetadata(name)
+		if err != nil {
+			continue // Skip modules with metadata errors
+		}
+		idx.Modules = append(idx.Modules, *module)
+	}
+
+	sort.Slice(idx.Modules, func(i, j int) bool { return idx.Modules[i].Name < idx.Modules[j].Name })
+	idx.buildLookup()
+	return idx, nil
+}
+
+func (idx *registryIndex) buildLookup() {
+	idx.byName = make(map[string]*Module, len(idx.Modules))
+	for i := range idx.Modules {
+		idx.byName[idx.Modules[i].Name] = &idx.Modules[i]
+	}
+}
+
+// lookup returns the indexed module by exact name
+func (idx *registryIndex) lookup(name string) (*Module, bool) {
+	module, ok := idx.byName[name]
+	return module, ok
+}
+
+// search returns modules matching the query, best matches first: exact name,
+// then prefix, then substring, then fuzzy subsequence matches
+func (idx *registryIndex) search(query string) []Module {
+	queryLower := strings.ToLower(query)
+
+	var exact, prefix, substring, fuzzy []Module
+	for _, module := range idx.Modules {
+		nameLower := strings.ToLower(module.Name)
+		switch {
+		case nameLower == queryLower:
+			exact = append(exact, module)
+		case strings.HasPrefix(nameLower, queryLower):
+			prefix = append(prefix, module)
+		case strings.Contains(nameLower, queryLower):
+			substring = append(substring, module)
+		case fuzzyMatch(nameLower, queryLower):
+			fuzzy = append(fuzzy, module)
+		}
+	}
+
+	results := append(exact, prefix...)
+	results = append(results, substring...)
+	return append(results, fuzzy...)
+}
+
+// fuzzyMatch reports whether query is a subsequence of name
+// (e.g. "gbench" matches "google_benchmark")
+func fuzzyMatch(name, query string) bool {
+	if query == "" {
+		return true
+	}
+	i := 0
+	for _, ch := range name {
+		if byte(ch) == query[i] {
+			i++
+			if i == len(query) {
+				return true
+			}
+		}
+	}
+	return false
+}
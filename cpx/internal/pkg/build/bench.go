@@ -1,16 +1,26 @@
 package build
 
 import (
+	"bytes"
 	"fmt"
+	"io"
 	"os"
 	"os/exec"
 	"path/filepath"
+	"time"
 
 	"github.com/ozacod/cpx/internal/pkg/vcpkg"
 )
 
 // RunBenchmarks builds and runs the project benchmarks
-func RunBenchmarks(verbose bool, vcpkgClient *vcpkg.Client) error {
+func RunBenchmarks(verbose bool, save string, compare string, thresholdPct float64, profile string, vcpkgClient *vcpkg.Client) error {
+	// Fail before the build, not after, when the sampler is missing
+	if profile != "" {
+		if err := CheckProfilingSupport(); err != nil {
+			return err
+		}
+	}
+
 	// Set VCPKG_ROOT from cpx config if not already set
 	if err := vcpkgClient.SetupEnv(); err != nil {
 		return err
@@ -109,8 +119,38 @@ func RunBenchmarks(verbose bool, vcpkgClient *vcpkg.Client) error {
 		return fmt.Errorf("benchmark executable not found. Tried: %v", possiblePaths)
 	}
 
-	benchCmd := exec.Command(benchPath)
+	// When tracking history, ask the framework for machine-readable output
+	// alongside the normal console output
+	tracking := save != "" || compare != ""
+	framework := ""
+	var benchArgs []string
+	var jsonOut, xmlOut string
+	var consoleBuf bytes.Buffer
+	if tracking {
+		framework = DetectBenchFramework()
+		switch framework {
+		case "google-benchmark":
+			jsonOut = filepath.Join(os.TempDir(), fmt.Sprintf("cpx-bench-%d.json", os.Getpid()))
+			benchArgs = append(benchArgs, "--benchmark_out="+jsonOut, "--benchmark_out_format=json")
+		case "catch2-benchmark":
+			xmlOut = filepath.Join(os.TempDir(), fmt.Sprintf("cpx-bench-%d.xml", os.Getpid()))
+			benchArgs = append(benchArgs, "--reporter", "console", "--reporter", "XML::out="+xmlOut)
+		}
+	}
+
+	// Under --profile the benchmark runs wrapped in perf record; the child's
+	// stdout passes through, so history tracking keeps working
+	var benchCmd *exec.Cmd
+	if profile != "" {
+		benchCmd = PerfRecordCommand(PerfDataFile(profile), benchPath, benchArgs)
+	} else {
+		benchCmd = exec.Command(benchPath, benchArgs...)
+	}
 	benchCmd.Stdout = os.Stdout
+	if tracking {
+		// Tee output; nanobench results are parsed from the console table
+		benchCmd.Stdout = io.MultiWriter(os.Stdout, &consoleBuf)
+	}
 	benchCmd.Stderr = os.Stderr
 
 	fmt.Println() // Add blank line before benchmark output
@@ -119,5 +159,54 @@ func RunBenchmarks(verbose bool, vcpkgClient *vcpkg.Client) error {
 	}
 
 	fmt.Printf("\n%s✓ Benchmarks completed!%s\n", "\033[32m", "\033[0m")
+
+	if profile != "" {
+		if err := GenerateFlamegraph(PerfDataFile(profile), profile); err != nil {
+			return err
+		}
+	}
+
+	if tracking {
+		var results []BenchResult
+		switch framework {
+		case "google-benchmark":
+			if data, err := os.ReadFile(jsonOut); err == nil {
+				results = ParseGoogleBenchmarkJSON(data)
+				os.Remove(jsonOut)
+			}
+		case "catch2-benchmark":
+			if data, err := os.ReadFile(xmlOut); err == nil {
+				results = ParseCatch2XML(data)
+				os.Remove(xmlOut)
+			}
+		default:
+			results = ParseNanobenchTable(consoleBuf.String())
+		}
+
+		if len(results) == 0 {
+			return fmt.Errorf("no benchmark results could be parsed; cannot track history")
+		}
+
+		run := BenchRun{Timestamp: time.Now(), Framework: framework, Results: results}
+		tsPath, err := SaveBenchRun(run, save)
+		if err != nil {
+			return err
+		}
+		fmt.Printf("%s  Recorded %d results in %s%s\n", colorGray, len(results), tsPath, colorReset)
+		if save != "" {
+			fmt.Printf("%s  Saved baseline '%s'%s\n", colorGreen, save, colorReset)
+		}
+
+		if compare != "" {
+			baseline, err := LoadBenchRun(compare)
+			if err != nil {
+				return err
+			}
+			if err := ReportComparison(CompareBenchRuns(baseline, &run, thresholdPct), compare, thresholdPct); err != nil {
+				return err
+			}
+		}
+	}
+
 	return nil
 }
@@ -0,0 +1,296 @@
+package build
+
+import (
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"strconv"
+	"strings"
+	"time"
+)
+
+// BenchResult is one benchmark measurement, normalized to nanoseconds so
+// runs from different frameworks and time units compare cleanly
+type BenchResult struct {
+	Name   string  `json:"name"`
+	TimeNs float64 `json:"time_ns"`
+}
+
+// BenchRun is a full benchmark run as stored under .cpx/bench-history
+type BenchRun struct {
+	Timestamp time.Time     `json:"timestamp"`
+	Framework string        `json:"framework"`
+	Results   []BenchResult `json:"results"`
+}
+
+// BenchComparison is the delta of one benchmark against a baseline
+type BenchComparison struct {
+	Name       string
+	BaselineNs float64
+	CurrentNs  float64
+	DeltaPct   float64
+	Regressed  bool
+}
+
+// benchHistoryDir is where timestamped runs and named baselines live
+func benchHistoryDir() string {
+	return filepath.Join(".cpx", "bench-history")
+}
+
+// DetectBenchFramework infers the benchmark framework from the project's
+// vcpkg.json dependencies (the three frameworks cpx new scaffolds)
+func DetectBenchFramework() string {
+	data, err := os.ReadFile("vcpkg.json")
+	if err != nil {
+		return ""
+	}
+
+	var manifest struct {
+		Dependencies []json.RawMessage `json:"dependencies"`
+	}
+	if err := json.Unmarshal(data, &manifest); err != nil {
+		return ""
+	}
+
+	deps := make(map[string]bool)
+	for _, raw := range manifest.Dependencies {
+		// Dependencies are either "name" or {"name": ..., ...}
+		var name string
+		if err := json.Unmarshal(raw, &name); err == nil {
+			deps[name] = true
+			continue
+		}
+		var obj struct {
+			Name string `json:"name"`
+		}
+		if err := json.Unmarshal(raw, &obj); err == nil && obj.Name != "" {
+			deps[obj.Name] = true
+		}
+	}
+
+	switch {
+	case deps["benchmark"]:
+		return "google-benchmark"
+	case deps["nanobench"]:
+		return "nanobench"
+	case deps["catch2"]:
+		return "catch2-benchmark"
+	}
+	return ""
+}
+
+// ParseGoogleBenchmarkJSON parses Google Benchmark's --benchmark_out JSON
+func ParseGoogleBenchmarkJSON(data []byte) []BenchResult {
+	var doc struct {
+		Benchmarks []struct {
+			Name     string  `json:"name"`
+			RunType  string  `json:"run_type"`
+			RealTime float64 `json:"real_time"`
+			TimeUnit string  `json:"time_unit"`
+		} `json:"benchmarks"`
+	}
+	if err := json.Unmarshal(data, &doc); err != nil {
+		return nil
+	}
+
+	var results []BenchResult
+	for _, b := range doc.Benchmarks {
+		// Skip mean/median/stddev aggregates from repeated runs
+		if b.RunType == "aggregate" {
+			continue
+		}
+		scale := 1.0
+		switch b.TimeUnit {
+		case "us":
+			scale = 1e3
+		case "ms":
+			scale = 1e6
+		case "s":
+			scale = 1e9
+		}
+		results = append(results, BenchResult{Name: b.Name, TimeNs: b.RealTime * scale})
+	}
+	return results
+}
+
+// ParseNanobenchTable parses nanobench's default console table, whose rows
+// look like "|    7.52 |  132,948,239.79 | 0.1% | 0.00 | `version`"
+func ParseNanobenchTable(output string) []BenchResult {
+	var results []BenchResult
+	for _, line := range strings.Split(output, "\n") {
+		line = strings.TrimSpace(line)
+		if !strings.HasPrefix(line, "|") || strings.Contains(line, "ns/op") || strings.HasPrefix(line, "|:") || strings.HasPrefix(line, "|-") {
+			continue
+		}
+
+		fields := strings.Split(line, "|")
+		if len(fields) < 3 {
+			continue
+		}
+
+		nsStr := strings.ReplaceAll(strings.TrimSpace(fields[1]), ",", "")
+		ns, err := strconv.ParseFloat(nsStr, 64)
+		if err != nil {
+			continue
+		}
+
+		name := strings.TrimSpace(fields[len(fields)-1])
+		name = strings.Trim(name, "`'\"")
+		if name == "" {
+			continue
+		}
+
+		results = append(results, BenchResult{Name: name, TimeNs: ns})
+	}
+	return results
+}
+
+// ParseCatch2XML parses Catch2's XML reporter output, extracting the mean
+// estimate (nanoseconds) of each <BenchmarkResults> block
+func ParseCatch2XML(data []byte) []BenchResult {
+	content := string(data)
+	var results []BenchResult
+
+	searchStart := 0
+	for {
+		start := strings.Index(content[searchStart:], "<BenchmarkResults")
+		if start == -1 {
+			break
+		}
+		start += searchStart
+		end := strings.Index(content[start:], "</BenchmarkResults>")
+		if end == -1 {
+			break
+		}
+		end += start
+
+		block := content[start:end]
+		name := benchXMLAttr(block[:strings.Index(block, ">")+1], "name")
+
+		if meanIdx := strings.Index(block, "<mean"); meanIdx >= 0 {
+			meanTag := block[meanIdx:]
+			if closeIdx := strings.Index(meanTag, ">"); closeIdx > 0 {
+				meanTag = meanTag[:closeIdx]
+			}
+			if ns, err := strconv.ParseFloat(benchXMLAttr(meanTag, "value"), 64); err == nil && name != "" {
+				results = append(results, BenchResult{Name: name, TimeNs: ns})
+			}
+		}
+
+		searchStart = end
+	}
+	return results
+}
+
+func benchXMLAttr(tag, attr string) string {
+	prefix := attr + "=\""
+	start := strings.Index(tag, prefix)
+	if start == -1 {
+		return ""
+	}
+	start += len(prefix)
+	end := strings.Index(tag[start:], "\"")
+	if end == -1 {
+		return ""
+	}
+	return tag[start : start+end]
+}
+
+// SaveBenchRun stores a run as a timestamped file under .cpx/bench-history,
+// plus a named baseline copy when label is non-empty. Returns the
+// timestamped path.
+func SaveBenchRun(run BenchRun, label string) (string, error) {
+	dir := benchHistoryDir()
+	if err := os.MkdirAll(dir, 0755); err != nil {
+		return "", fmt.Errorf("failed to create bench history dir: %w", err)
+	}
+
+	data, err := json.MarshalIndent(run, "", "  ")
+	if err != nil {
+		return "", fmt.Errorf("failed to encode benchmark run: %w", err)
+	}
+
+	tsPath := filepath.Join(dir, run.Timestamp.UTC().Format("20060102-150405")+".json")
+	if err := os.WriteFile(tsPath, data, 0644); err != nil {
+		return "", fmt.Errorf("failed to write benchmark run: %w", err)
+	}
+
+	if label != "" {
+		labelPath := filepath.Join(dir, label+".json")
+		if err := os.WriteFile(labelPath, data, 0644); err != nil {
+			return "", fmt.Errorf("failed to write baseline '%s': %w", label, err)
+		}
+	}
+
+	return tsPath, nil
+}
+
+// LoadBenchRun loads a named baseline from .cpx/bench-history
+func LoadBenchRun(label string) (*BenchRun, error) {
+	path := filepath.Join(benchHistoryDir(), label+".json")
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return nil, fmt.Errorf("baseline '%s' not found. Run: cpx bench --save %s", label, label)
+	}
+
+	var run BenchRun
+	if err := json.Unmarshal(data, &run); err != nil {
+		return nil, fmt.Errorf("failed to parse baseline '%s': %w", label, err)
+	}
+	return &run, nil
+}
+
+// CompareBenchRuns diffs current against baseline. A benchmark regresses when
+// it is more than thresholdPct percent slower than the baseline.
+func CompareBenchRuns(baseline, current *BenchRun, thresholdPct float64) []BenchComparison {
+	baselineTimes := make(map[string]float64, len(baseline.Results))
+	for _, r := range baseline.Results {
+		baselineTimes[r.Name] = r.TimeNs
+	}
+
+	var comparisons []BenchComparison
+	for _, r := range current.Results {
+		base, ok := baselineTimes[r.Name]
+		if !ok || base == 0 {
+			continue
+		}
+		deltaPct := (r.TimeNs - base) / base * 100
+		comparisons = append(comparisons, BenchComparison{
+			Name:       r.Name,
+			BaselineNs: base,
+			CurrentNs:  r.TimeNs,
+			DeltaPct:   deltaPct,
+			Regressed:  deltaPct > thresholdPct,
+		})
+	}
+	return comparisons
+}
+
+// ReportComparison prints the comparison table and returns an error when any
+// benchmark regressed past the threshold, so CI runs fail
+func ReportComparison(comparisons []BenchComparison, label string, thresholdPct float64) error {
+	fmt.Printf("\n%sComparison against baseline '%s'%s %s(threshold: +%.1f%%)%s\n",
+		colorCyan, label, colorReset, colorGray, thresholdPct, colorReset)
+
+	regressions := 0
+	for _, c := range comparisons {
+		status := colorGreen + "ok" + colorReset
+		if c.Regressed {
+			status = "\033[31mREGRESSED\033[0m"
+			regressions++
+		}
+		fmt.Printf("  %-40s %12.1f ns → %12.1f ns  %+6.1f%%  %s\n",
+			c.Name, c.BaselineNs, c.CurrentNs, c.DeltaPct, status)
+	}
+
+	if len(comparisons) == 0 {
+		fmt.Printf("  %sno common benchmarks between baseline and current run%s\n", colorGray, colorReset)
+		return nil
+	}
+
+	if regressions > 0 {
+		return fmt.Errorf("%d benchmark(s) regressed more than %.1f%% against baseline '%s'", regressions, thresholdPct, label)
+	}
+	return nil
+}
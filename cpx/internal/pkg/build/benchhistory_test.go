@@ -0,0 +1,108 @@
+package build
+
+import (
+	"os"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestParseGoogleBenchmarkJSON(t *testing.T) {
+	data := []byte(`{
+		"benchmarks": [
+			{"name": "BM_version", "run_type": "iteration", "real_time": 12.5, "time_unit": "ns"},
+			{"name": "BM_parse", "run_type": "iteration", "real_time": 3.2, "time_unit": "us"},
+			{"name": "BM_parse_mean", "run_type": "aggregate", "real_time": 3.1, "time_unit": "us"}
+		]
+	}`)
+
+	results := ParseGoogleBenchmarkJSON(data)
+	require.Len(t, results, 2)
+	assert.Equal(t, "BM_version", results[0].Name)
+	assert.Equal(t, 12.5, results[0].TimeNs)
+	assert.Equal(t, "BM_parse", results[1].Name)
+	assert.Equal(t, 3200.0, results[1].TimeNs)
+}
+
+func TestParseNanobenchTable(t *testing.T) {
+	output := `
+|               ns/op |                op/s |    err% |     total | benchmark
+|--------------------:|--------------------:|--------:|----------:|:----------
+|                7.52 |      132,948,239.79 |    0.1% |      0.00 | ` + "`version`" + `
+|            1,204.33 |          830,337.21 |    0.3% |      0.01 | ` + "`parse`" + `
+`
+
+	results := ParseNanobenchTable(output)
+	require.Len(t, results, 2)
+	assert.Equal(t, "version", results[0].Name)
+	assert.Equal(t, 7.52, results[0].TimeNs)
+	assert.Equal(t, "parse", results[1].Name)
+	assert.Equal(t, 1204.33, results[1].TimeNs)
+}
+
+func TestParseCatch2XML(t *testing.T) {
+	data := []byte(`<Catch2TestRun>
+  <TestCase name="Benchmark version">
+    <BenchmarkResults name="version" samples="100">
+      <mean value="42.7" lowerBound="41.9" upperBound="43.6"/>
+      <standardDeviation value="1.2"/>
+    </BenchmarkResults>
+  </TestCase>
+</Catch2TestRun>`)
+
+	results := ParseCatch2XML(data)
+	require.Len(t, results, 1)
+	assert.Equal(t, "version", results[0].Name)
+	assert.Equal(t, 42.7, results[0].TimeNs)
+}
+
+func TestCompareBenchRuns(t *testing.T) {
+	baseline := &BenchRun{Results: []BenchResult{
+		{Name: "BM_fast", TimeNs: 100},
+		{Name: "BM_slow", TimeNs: 1000},
+		{Name: "BM_removed", TimeNs: 50},
+	}}
+	current := &BenchRun{Results: []BenchResult{
+		{Name: "BM_fast", TimeNs: 103},  // +3%, within threshold
+		{Name: "BM_slow", TimeNs: 1200}, // +20%, regressed
+		{Name: "BM_new", TimeNs: 10},    // no baseline, skipped
+	}}
+
+	comparisons := CompareBenchRuns(baseline, current, 5.0)
+	require.Len(t, comparisons, 2)
+
+	assert.Equal(t, "BM_fast", comparisons[0].Name)
+	assert.False(t, comparisons[0].Regressed)
+	assert.Equal(t, "BM_slow", comparisons[1].Name)
+	assert.True(t, comparisons[1].Regressed)
+	assert.InDelta(t, 20.0, comparisons[1].DeltaPct, 0.01)
+}
+
+func TestSaveAndLoadBenchRun(t *testing.T) {
+	tmpDir := t.TempDir()
+	oldWd, err := os.Getwd()
+	require.NoError(t, err)
+	defer os.Chdir(oldWd)
+	require.NoError(t, os.Chdir(tmpDir))
+
+	run := BenchRun{
+		Timestamp: time.Date(2026, 8, 28, 12, 0, 0, 0, time.UTC),
+		Framework: "google-benchmark",
+		Results:   []BenchResult{{Name: "BM_version", TimeNs: 12.5}},
+	}
+
+	tsPath, err := SaveBenchRun(run, "main")
+	require.NoError(t, err)
+	assert.FileExists(t, tsPath)
+
+	loaded, err := LoadBenchRun("main")
+	require.NoError(t, err)
+	assert.Equal(t, run.Framework, loaded.Framework)
+	require.Len(t, loaded.Results, 1)
+	assert.Equal(t, "BM_version", loaded.Results[0].Name)
+
+	_, err = LoadBenchRun("missing")
+	assert.Error(t, err)
+}
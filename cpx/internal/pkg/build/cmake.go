@@ -65,6 +65,23 @@ func DetermineBuildType(release bool, optLevel string) (string, string) {
 	return buildType, cxxFlags
 }
 
+// VariantDirName returns the per-configuration directory name under
+// .cache/native and .bin/native (e.g. "debug", "release", "O2-asan").
+// Every flavor keeps its own build tree so flipping configurations never
+// invalidates another flavor's incremental state.
+func VariantDirName(release bool, optLevel string, sanitizer string) string {
+	name := "debug"
+	if optLevel != "" {
+		name = "O" + optLevel
+	} else if release {
+		name = "release"
+	}
+	if sanitizer != "" {
+		name += "-" + sanitizer
+	}
+	return name
+}
+
 // GetSanitizerFlags returns the CXX flags and linker flags for the given sanitizer
 func GetSanitizerFlags(sanitizer string) (string, string) {
 	cxxFlags := ""
@@ -86,13 +103,180 @@ func GetSanitizerFlags(sanitizer string) (string, string) {
 	return cxxFlags, linkerFlags
 }
 
+// GetLTOFlags returns the CXX flags and linker flags for the given LTO mode
+// ("thin" or "full"). ThinLTO is parallelized across jobs when jobs > 0.
+// Full LTO is left to CMake via CMAKE_INTERPROCEDURAL_OPTIMIZATION, so it
+// returns no flags here.
+func GetLTOFlags(lto string, jobs int) (string, string) {
+	if lto != "thin" {
+		return "", ""
+	}
+	cxxFlags := " -flto=thin"
+	linkerFlags := " -flto=thin"
+	if jobs > 0 {
+		linkerFlags += fmt.Sprintf(" -Wl,--thinlto-jobs=%d", jobs)
+	}
+	return cxxFlags, linkerFlags
+}
+
+// ResolveLinker validates the requested fast linker and checks it is usable.
+// "auto" picks the fastest linker available in PATH (mold, then lld);
+// "" keeps the compiler default and resolves to "".
+func ResolveLinker(linker string) (string, error) {
+	switch linker {
+	case "":
+		return "", nil
+	case "auto":
+		for _, candidate := range []string{"mold", "lld"} {
+			if linkerAvailable(candidate) {
+				return candidate, nil
+			}
+		}
+		return "", fmt.Errorf("no fast linker found in PATH (install mold or lld, or drop --linker)")
+	case "mold", "lld":
+		if !linkerAvailable(linker) {
+			return "", fmt.Errorf("linker '%s' not found in PATH", linker)
+		}
+		return linker, nil
+	default:
+		return "", fmt.Errorf("invalid linker '%s' (expected mold, lld, or auto)", linker)
+	}
+}
+
+// linkerAvailable reports whether the linker's binary is in PATH.
+// lld is installed as ld.lld; mold ships under its own name.
+func linkerAvailable(linker string) bool {
+	binary := linker
+	if linker == "lld" {
+		binary = "ld.lld"
+	}
+	_, err := exec.LookPath(binary)
+	return err == nil
+}
+
+// GetLinkerFlags returns the linker flags that route linking through the
+// given fast linker (empty when linker is "")
+func GetLinkerFlags(linker string) string {
+	if linker == "" {
+		return ""
+	}
+	return " -fuse-ld=" + linker
+}
+
+// GetPGOFlags returns the CXX flags and linker flags for the given PGO phase:
+// "gen" instruments the build, "use" consumes the merged profile data in
+// profileDir. The profile directory should be absolute so instrumented
+// binaries write profiles there no matter where they are run from.
+func GetPGOFlags(pgo string, profileDir string) (string, string) {
+	switch pgo {
+	case "gen":
+		flag := " -fprofile-generate=" + profileDir
+		return flag, flag
+	case "use":
+		flag := " -fprofile-use=" + filepath.Join(profileDir, "default.profdata")
+		return flag, flag
+	}
+	return "", ""
+}
+
+// PGOProfileDir returns the per-project directory where instrumented binaries
+// drop raw profiles and where merged profdata is kept between PGO rebuilds.
+func PGOProfileDir() string {
+	cwd, _ := os.Getwd()
+	return filepath.Join(cwd, ".cache", "pgo")
+}
+
+// MergePGOProfiles merges raw profiles in profileDir into default.profdata
+// using llvm-profdata. An existing default.profdata is folded into the merge
+// so incremental training runs accumulate, and raw profiles are removed after
+// a successful merge. Returns the path to the merged profile.
+func MergePGOProfiles(profileDir string) (string, error) {
+	profData := filepath.Join(profileDir, "default.profdata")
+	raws, _ := filepath.Glob(filepath.Join(profileDir, "*.profraw"))
+	if len(raws) == 0 {
+		// Nothing new to merge; reuse the previous profdata if we have one
+		if _, err := os.Stat(profData); err == nil {
+			return profData, nil
+		}
+		return "", fmt.Errorf("no profiles in %s: build with --pgo-gen and run the binary to collect training data first", profileDir)
+	}
+
+	// Merge into a temp file so a previous default.profdata can be an input
+	merged := profData + ".tmp"
+	args := []string{"merge", "-output=" + merged}
+	if _, err := os.Stat(profData); err == nil {
+		args = append(args, profData)
+	}
+	args = append(args, raws...)
+
+	cmd := exec.Command("llvm-profdata", args...)
+	cmd.Stdout = os.Stdout
+	cmd.Stderr = os.Stderr
+	if err := cmd.Run(); err != nil {
+		return "", fmt.Errorf("llvm-profdata merge failed: %w", err)
+	}
+	if err := os.Rename(merged, profData); err != nil {
+		return "", fmt.Errorf("failed to install merged profile: %w", err)
+	}
+	for _, raw := range raws {
+		os.Remove(raw)
+	}
+	return profData, nil
+}
+
+// DetectCompilerLauncher returns the compiler cache launcher to wire into builds.
+// CPX_COMPILER_LAUNCHER overrides detection ("none" disables caching);
+// otherwise the first of ccache/sccache found in PATH is used.
+func DetectCompilerLauncher() string {
+	if launcher := os.Getenv("CPX_COMPILER_LAUNCHER"); launcher != "" {
+		if launcher == "none" {
+			return ""
+		}
+		return launcher
+	}
+	for _, candidate := range []string{"ccache", "sccache"} {
+		if _, err := exec.LookPath(candidate); err == nil {
+			return candidate
+		}
+	}
+	return ""
+}
+
+// CompilerLauncherArgs returns the CMake arguments that route compilation
+// through the detected compiler cache (empty when no launcher is available)
+func CompilerLauncherArgs() []string {
+	launcher := DetectCompilerLauncher()
+	if launcher == "" {
+		return nil
+	}
+	return []string{
+		"-DCMAKE_C_COMPILER_LAUNCHER=" + launcher,
+		"-DCMAKE_CXX_COMPILER_LAUNCHER=" + launcher,
+	}
+}
+
 // BuildProject builds the project using CMake
-func BuildProject(release bool, jobs int, target string, clean bool, optLevel string, verbose bool, sanitizer string, vcpkgClient *vcpkg.Client) error {
+func BuildProject(release bool, jobs int, target string, clean bool, optLevel string, verbose bool, sanitizer string, unity bool, lto string, pgo string, linker string, timeTrace bool, stats bool, remote bool, vcpkgClient *vcpkg.Client) error {
 	// Set VCPKG_ROOT from cpx config if not already set
 	if err := vcpkgClient.SetupEnv(); err != nil {
 		return err
 	}
 
+	// Resolve the remote launcher up front so a missing distcc/icecc fails
+	// before anything is configured
+	remoteLauncher := ""
+	if remote {
+		var err error
+		remoteLauncher, err = DetectRemoteLauncher()
+		if err != nil {
+			return err
+		}
+		if jobs == 0 {
+			jobs = RemoteJobs(remoteLauncher)
+		}
+		fmt.Printf("%sDistributing compilation through %s (%d jobs)%s\n", colorCyan, remoteLauncher, jobs, colorReset)
+	}
+
 	// Get project name from CMakeLists.txt (optional, for display only)
 	projectName := GetProjectNameFromCMakeLists()
 	if projectName == "" {
@@ -100,15 +284,30 @@ func BuildProject(release bool, jobs int, target string, clean bool, optLevel st
 	}
 
 	// Determine build output directory based on optimization/release/sanitizer
-	outDirName := "debug"
-	if optLevel != "" {
-		outDirName = "O" + optLevel
-	} else if release {
-		outDirName = "release"
+	outDirName := VariantDirName(release, optLevel, sanitizer)
+	// Unity builds batch TUs differently, keep their incremental state separate
+	if unity {
+		outDirName += "-unity"
 	}
-	// Append sanitizer suffix
-	if sanitizer != "" {
-		outDirName += "-" + sanitizer
+	// LTO object files are incompatible with non-LTO ones, keep them separate
+	if lto != "" {
+		outDirName += "-lto-" + lto
+	}
+	// Instrumented and profile-optimized builds each get their own state
+	if pgo != "" {
+		outDirName += "-pgo-" + pgo
+	}
+	// Linker flags are baked in at configure time, keep per-linker state separate
+	if linker != "" {
+		outDirName += "-" + linker
+	}
+	// Tracing recompiles every TU with -ftime-trace, keep it off the hot dirs
+	if timeTrace {
+		outDirName += "-trace"
+	}
+	// The launcher chain is baked in at configure time, keep remote state separate
+	if remote {
+		outDirName += "-remote"
 	}
 
 	// Use hidden cache directory for build artifacts
@@ -139,6 +338,36 @@ func BuildProject(release bool, jobs int, target string, clean bool, optLevel st
 	cxxFlags += sanCFlags
 	linkerFlags := sanLFlags
 
+	// Add LTO flags (ThinLTO only; full LTO goes through CMake's IPO support)
+	ltoCFlags, ltoLFlags := GetLTOFlags(lto, jobs)
+	cxxFlags += ltoCFlags
+	linkerFlags += ltoLFlags
+
+	// Add PGO flags; --pgo-use needs merged profile data before configuring
+	pgoDir := ""
+	if pgo != "" {
+		pgoDir = PGOProfileDir()
+		if err := os.MkdirAll(pgoDir, 0755); err != nil {
+			return fmt.Errorf("failed to create PGO profile dir: %w", err)
+		}
+		if pgo == "use" {
+			if _, err := MergePGOProfiles(pgoDir); err != nil {
+				return err
+			}
+		}
+	}
+	pgoCFlags, pgoLFlags := GetPGOFlags(pgo, pgoDir)
+	cxxFlags += pgoCFlags
+	linkerFlags += pgoLFlags
+
+	// Route linking through the requested fast linker
+	linkerFlags += GetLinkerFlags(linker)
+
+	// Emit per-TU compile-time traces for the report
+	if timeTrace {
+		cxxFlags += GetTimeTraceFlags()
+	}
+
 	optLabel := "default (-O0)"
 	if release {
 		optLabel = "-O2 (Release)"
@@ -149,11 +378,33 @@ func BuildProject(release bool, jobs int, target string, clean bool, optLevel st
 	if sanitizer != "" {
 		optLabel += "+" + sanitizer
 	}
+	if unity {
+		optLabel += "+unity"
+	}
+	if lto != "" {
+		optLabel += "+" + lto + "lto"
+	}
+	if pgo != "" {
+		optLabel += "+pgo-" + pgo
+	}
+	if linker != "" {
+		optLabel += "+" + linker
+	}
+	if timeTrace {
+		optLabel += "+trace"
+	}
+	if remote {
+		optLabel += "+remote"
+	}
 
 	fmt.Printf("\n%s▸ Build%s %s %s(%s)%s %s[opt: %s]%s\n",
 		colorCyan, colorReset, projectName, colorGray, buildType, colorReset,
 		colorGray, optLabel, colorReset)
 
+	// Ask CMake for a target reply on the next configure, so executables are
+	// listed from the manifest instead of a build-tree walk
+	EnableCMakeFileAPI(cacheBuildDir)
+
 	// Configure CMake if needed
 	needsConfigure := false
 	if _, err := os.Stat(filepath.Join(cacheBuildDir, "CMakeCache.txt")); os.IsNotExist(err) {
@@ -192,6 +443,17 @@ func BuildProject(release bool, jobs int, target string, clean bool, optLevel st
 			if linkerFlags != "" {
 				cmdArgs = append(cmdArgs, "-DCMAKE_EXE_LINKER_FLAGS="+linkerFlags, "-DCMAKE_SHARED_LINKER_FLAGS="+linkerFlags)
 			}
+			if remote {
+				cmdArgs = append(cmdArgs, RemoteLauncherArgs(remoteLauncher)...)
+			} else {
+				cmdArgs = append(cmdArgs, CompilerLauncherArgs()...)
+			}
+			if unity {
+				cmdArgs = append(cmdArgs, "-DCMAKE_UNITY_BUILD=ON")
+			}
+			if lto == "full" {
+				cmdArgs = append(cmdArgs, "-DCMAKE_INTERPROCEDURAL_OPTIMIZATION=ON")
+			}
 			cmd := exec.Command("cmake", cmdArgs...)
 			cmd.Env = os.Environ()
 			if err := runCMakeConfigure(cmd, verbose); err != nil {
@@ -207,6 +469,17 @@ func BuildProject(release bool, jobs int, target string, clean bool, optLevel st
 			if linkerFlags != "" {
 				cmdArgs = append(cmdArgs, "-DCMAKE_EXE_LINKER_FLAGS="+linkerFlags, "-DCMAKE_SHARED_LINKER_FLAGS="+linkerFlags)
 			}
+			if remote {
+				cmdArgs = append(cmdArgs, RemoteLauncherArgs(remoteLauncher)...)
+			} else {
+				cmdArgs = append(cmdArgs, CompilerLauncherArgs()...)
+			}
+			if unity {
+				cmdArgs = append(cmdArgs, "-DCMAKE_UNITY_BUILD=ON")
+			}
+			if lto == "full" {
+				cmdArgs = append(cmdArgs, "-DCMAKE_INTERPROCEDURAL_OPTIMIZATION=ON")
+			}
 			cmd := exec.Command("cmake", cmdArgs...)
 			cmd.Env = os.Environ()
 			if err := runCMakeConfigure(cmd, verbose); err != nil {
@@ -220,6 +493,13 @@ func BuildProject(release bool, jobs int, target string, clean bool, optLevel st
 		}
 	}
 
+	// Snapshot the Ninja log so this run's rebuilt targets can be told apart
+	// from cache hits afterwards
+	var ninjaLogOffset int64
+	if stats {
+		ninjaLogOffset = SnapshotNinjaLog(cacheBuildDir)
+	}
+
 	// Build specific target if provided
 	buildStart := time.Now()
 	// Build in .cache directory
@@ -251,7 +531,7 @@ func BuildProject(release bool, jobs int, target string, clean bool, optLevel st
 		return fmt.Errorf("failed to create final build dir: %w", err)
 	}
 
-	executables, err := FindExecutables(cacheBuildDir)
+	executables, err := FindExecutablesCached(cacheBuildDir)
 	if err == nil {
 		for _, exe := range executables {
 			dest := filepath.Join(finalBuildDir, filepath.Base(exe))
@@ -265,5 +545,29 @@ func BuildProject(release bool, jobs int, target string, clean bool, optLevel st
 
 	fmt.Printf("%s  ✔ Build complete%s %s[%s]%s\n", colorGreen, colorReset, colorGray, time.Since(buildStart).Round(10*time.Millisecond), colorReset)
 	fmt.Printf("  Artifacts in: %s/\n\n", finalBuildDir)
+
+	if pgo == "gen" {
+		fmt.Printf("%s  Instrumented build ready.%s Exercise it with representative workloads\n", colorCyan, colorReset)
+		fmt.Printf("  (e.g. cpx run), then rebuild with: cpx build --pgo-use\n\n")
+	}
+
+	// Record per-target telemetry and print the slowest-targets report
+	if stats {
+		RecordBuildStats(cacheBuildDir, outDirName, ninjaLogOffset)
+	}
+
+	// Aggregate the per-TU traces into the compile-time report
+	if timeTrace {
+		traceReport, err := CollectTimeTraces(cacheBuildDir)
+		if err != nil {
+			return err
+		}
+		PrintTimeTraceSummary(traceReport)
+		reportFile := "compile-time-report.html"
+		if err := WriteTimeTraceReport(traceReport, reportFile); err != nil {
+			return err
+		}
+		fmt.Printf("\n%s  Full report: %s%s\n\n", colorCyan, reportFile, colorReset)
+	}
 	return nil
 }
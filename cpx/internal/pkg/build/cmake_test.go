@@ -1,9 +1,11 @@
 package build
 
 import (
+	"os"
 	"testing"
 
 	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
 )
 
 func TestGetSanitizerFlags(t *testing.T) {
@@ -59,3 +61,206 @@ func TestGetSanitizerFlags(t *testing.T) {
 		})
 	}
 }
+
+func TestGetLTOFlags(t *testing.T) {
+	tests := []struct {
+		name            string
+		lto             string
+		jobs            int
+		wantCxxFlags    string
+		wantLinkerFlags string
+	}{
+		{
+			name:            "No LTO",
+			lto:             "",
+			wantCxxFlags:    "",
+			wantLinkerFlags: "",
+		},
+		{
+			name:            "ThinLTO",
+			lto:             "thin",
+			wantCxxFlags:    " -flto=thin",
+			wantLinkerFlags: " -flto=thin",
+		},
+		{
+			name:            "ThinLTO with jobs",
+			lto:             "thin",
+			jobs:            8,
+			wantCxxFlags:    " -flto=thin",
+			wantLinkerFlags: " -flto=thin -Wl,--thinlto-jobs=8",
+		},
+		{
+			name:            "Full LTO goes through CMake IPO",
+			lto:             "full",
+			wantCxxFlags:    "",
+			wantLinkerFlags: "",
+		},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			gotCxx, gotLinker := GetLTOFlags(tt.lto, tt.jobs)
+			assert.Equal(t, tt.wantCxxFlags, gotCxx)
+			assert.Equal(t, tt.wantLinkerFlags, gotLinker)
+		})
+	}
+}
+
+func TestGetPGOFlags(t *testing.T) {
+	tests := []struct {
+		name            string
+		pgo             string
+		profileDir      string
+		wantCxxFlags    string
+		wantLinkerFlags string
+	}{
+		{
+			name:            "No PGO",
+			pgo:             "",
+			profileDir:      "/proj/.cache/pgo",
+			wantCxxFlags:    "",
+			wantLinkerFlags: "",
+		},
+		{
+			name:            "Instrumented build",
+			pgo:             "gen",
+			profileDir:      "/proj/.cache/pgo",
+			wantCxxFlags:    " -fprofile-generate=/proj/.cache/pgo",
+			wantLinkerFlags: " -fprofile-generate=/proj/.cache/pgo",
+		},
+		{
+			name:            "Optimized rebuild",
+			pgo:             "use",
+			profileDir:      "/proj/.cache/pgo",
+			wantCxxFlags:    " -fprofile-use=/proj/.cache/pgo/default.profdata",
+			wantLinkerFlags: " -fprofile-use=/proj/.cache/pgo/default.profdata",
+		},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			gotCxx, gotLinker := GetPGOFlags(tt.pgo, tt.profileDir)
+			assert.Equal(t, tt.wantCxxFlags, gotCxx)
+			assert.Equal(t, tt.wantLinkerFlags, gotLinker)
+		})
+	}
+}
+
+func TestMergePGOProfiles_NoProfiles(t *testing.T) {
+	dir := t.TempDir()
+	_, err := MergePGOProfiles(dir)
+	assert.Error(t, err)
+	assert.Contains(t, err.Error(), "--pgo-gen")
+}
+
+func TestMergePGOProfiles_ReusesExistingProfdata(t *testing.T) {
+	dir := t.TempDir()
+	profData := dir + "/default.profdata"
+	require.NoError(t, os.WriteFile(profData, []byte("profdata"), 0644))
+
+	got, err := MergePGOProfiles(dir)
+	assert.NoError(t, err)
+	assert.Equal(t, profData, got)
+}
+
+func TestDetectCompilerLauncher(t *testing.T) {
+	t.Run("Explicit override", func(t *testing.T) {
+		t.Setenv("CPX_COMPILER_LAUNCHER", "sccache")
+		assert.Equal(t, "sccache", DetectCompilerLauncher())
+	})
+
+	t.Run("Disabled with none", func(t *testing.T) {
+		t.Setenv("CPX_COMPILER_LAUNCHER", "none")
+		assert.Equal(t, "", DetectCompilerLauncher())
+	})
+}
+
+func TestCompilerLauncherArgs(t *testing.T) {
+	t.Run("With launcher", func(t *testing.T) {
+		t.Setenv("CPX_COMPILER_LAUNCHER", "ccache")
+		args := CompilerLauncherArgs()
+		assert.Equal(t, []string{
+			"-DCMAKE_C_COMPILER_LAUNCHER=ccache",
+			"-DCMAKE_CXX_COMPILER_LAUNCHER=ccache",
+		}, args)
+	})
+
+	t.Run("Disabled", func(t *testing.T) {
+		t.Setenv("CPX_COMPILER_LAUNCHER", "none")
+		assert.Empty(t, CompilerLauncherArgs())
+	})
+}
+
+func TestResolveLinker(t *testing.T) {
+	// Fake PATH with only mold available
+	binDir := t.TempDir()
+	require.NoError(t, os.WriteFile(binDir+"/mold", []byte("#!/bin/sh\n"), 0755))
+	t.Setenv("PATH", binDir)
+
+	t.Run("Default keeps compiler linker", func(t *testing.T) {
+		got, err := ResolveLinker("")
+		assert.NoError(t, err)
+		assert.Equal(t, "", got)
+	})
+
+	t.Run("Auto prefers mold", func(t *testing.T) {
+		got, err := ResolveLinker("auto")
+		assert.NoError(t, err)
+		assert.Equal(t, "mold", got)
+	})
+
+	t.Run("Explicit mold", func(t *testing.T) {
+		got, err := ResolveLinker("mold")
+		assert.NoError(t, err)
+		assert.Equal(t, "mold", got)
+	})
+
+	t.Run("Missing lld errors", func(t *testing.T) {
+		_, err := ResolveLinker("lld")
+		assert.Error(t, err)
+		assert.Contains(t, err.Error(), "not found in PATH")
+	})
+
+	t.Run("Auto falls back to lld", func(t *testing.T) {
+		require.NoError(t, os.Remove(binDir+"/mold"))
+		require.NoError(t, os.WriteFile(binDir+"/ld.lld", []byte("#!/bin/sh\n"), 0755))
+		got, err := ResolveLinker("auto")
+		assert.NoError(t, err)
+		assert.Equal(t, "lld", got)
+	})
+
+	t.Run("Invalid linker", func(t *testing.T) {
+		_, err := ResolveLinker("gold")
+		assert.Error(t, err)
+		assert.Contains(t, err.Error(), "invalid linker")
+	})
+}
+
+func TestGetLinkerFlags(t *testing.T) {
+	assert.Equal(t, "", GetLinkerFlags(""))
+	assert.Equal(t, " -fuse-ld=mold", GetLinkerFlags("mold"))
+	assert.Equal(t, " -fuse-ld=lld", GetLinkerFlags("lld"))
+}
+
+func TestVariantDirName(t *testing.T) {
+	tests := []struct {
+		name      string
+		release   bool
+		optLevel  string
+		sanitizer string
+		expected  string
+	}{
+		{"Default debug", false, "", "", "debug"},
+		{"Release", true, "", "", "release"},
+		{"Opt level wins over release", true, "2", "", "O2"},
+		{"Debug with asan", false, "", "asan", "debug-asan"},
+		{"Release with tsan", true, "", "tsan", "release-tsan"},
+		{"Opt level with ubsan", false, "3", "ubsan", "O3-ubsan"},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			assert.Equal(t, tt.expected, VariantDirName(tt.release, tt.optLevel, tt.sanitizer))
+		})
+	}
+}
@@ -0,0 +1,203 @@
+package build
+
+import (
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+)
+
+// TargetManifest maps executable target names to their built artifacts,
+// extracted once from the CMake File API reply so cpx run does not have to
+// re-walk the build tree on every invocation
+type TargetManifest struct {
+	Stamp   string            `json:"stamp"`
+	Targets map[string]string `json:"targets"` // target name -> artifact path relative to the build dir
+}
+
+const targetManifestName = ".cpx-targets.json"
+
+// EnableCMakeFileAPI drops a codemodel query into the build directory so the
+// next CMake configure writes a machine-readable target reply. Failures are
+// non-fatal; FindExecutablesCached falls back to the directory scan.
+func EnableCMakeFileAPI(buildDir string) {
+	queryDir := filepath.Join(buildDir, ".cmake", "api", "v1", "query")
+	if err := os.MkdirAll(queryDir, 0755); err != nil {
+		return
+	}
+	_ = os.WriteFile(filepath.Join(queryDir, "codemodel-v2"), nil, 0644)
+}
+
+// manifestStamp ties a manifest to one configure; when CMakeCache.txt
+// changes the manifest is rebuilt from the fresh reply
+func manifestStamp(buildDir string) string {
+	info, err := os.Stat(filepath.Join(buildDir, "CMakeCache.txt"))
+	if err != nil {
+		return ""
+	}
+	return fmt.Sprintf("%d", info.ModTime().UnixNano())
+}
+
+// LoadTargetManifest reads the manifest from the build directory, returning
+// false when it is missing, unreadable or stale
+func LoadTargetManifest(buildDir string) (*TargetManifest, bool) {
+	data, err := os.ReadFile(filepath.Join(buildDir, targetManifestName))
+	if err != nil {
+		return nil, false
+	}
+
+	var manifest TargetManifest
+	if err := json.Unmarshal(data, &manifest); err != nil {
+		return nil, false
+	}
+
+	stamp := manifestStamp(buildDir)
+	if stamp == "" || manifest.Stamp != stamp {
+		return nil, false
+	}
+	return &manifest, true
+}
+
+// RefreshTargetManifest parses the CMake File API reply in the build
+// directory and writes a fresh manifest next to CMakeCache.txt
+func RefreshTargetManifest(buildDir string) (*TargetManifest, error) {
+	replyDir := filepath.Join(buildDir, ".cmake", "api", "v1", "reply")
+	entries, err := os.ReadDir(replyDir)
+	if err != nil {
+		return nil, fmt.Errorf("no CMake File API reply in %s: %w", buildDir, err)
+	}
+
+	// The index file names embed a timestamp; the lexicographically last one
+	// is the most recent configure
+	var indexFile string
+	for _, entry := range entries {
+		name := entry.Name()
+		if strings.HasPrefix(name, "index-") && strings.HasSuffix(name, ".json") && name > indexFile {
+			indexFile = name
+		}
+	}
+	if indexFile == "" {
+		return nil, fmt.Errorf("no CMake File API index in %s", replyDir)
+	}
+
+	indexData, err := os.ReadFile(filepath.Join(replyDir, indexFile))
+	if err != nil {
+		return nil, fmt.Errorf("failed to read File API index: %w", err)
+	}
+
+	var index struct {
+		Objects []struct {
+			Kind     string `json:"kind"`
+			JSONFile string `json:"jsonFile"`
+		} `json:"objects"`
+	}
+	if err := json.Unmarshal(indexData, &index); err != nil {
+		return nil, fmt.Errorf("failed to parse File API index: %w", err)
+	}
+
+	var codemodelFile string
+	for _, obj := range index.Objects {
+		if obj.Kind == "codemodel" {
+			codemodelFile = obj.JSONFile
+			break
+		}
+	}
+	if codemodelFile == "" {
+		return nil, fmt.Errorf("no codemodel object in File API reply")
+	}
+
+	codemodelData, err := os.ReadFile(filepath.Join(replyDir, codemodelFile))
+	if err != nil {
+		return nil, fmt.Errorf("failed to read codemodel: %w", err)
+	}
+
+	var codemodel struct {
+		Configurations []struct {
+			Targets []struct {
+				JSONFile string `json:"jsonFile"`
+			} `json:"targets"`
+		} `json:"configurations"`
+	}
+	if err := json.Unmarshal(codemodelData, &codemodel); err != nil {
+		return nil, fmt.Errorf("failed to parse codemodel: %w", err)
+	}
+
+	manifest := &TargetManifest{
+		Stamp:   manifestStamp(buildDir),
+		Targets: make(map[string]string),
+	}
+
+	for _, config := range codemodel.Configurations {
+		for _, targetRef := range config.Targets {
+			targetData, err := os.ReadFile(filepath.Join(replyDir, targetRef.JSONFile))
+			if err != nil {
+				continue
+			}
+
+			var target struct {
+				Name      string `json:"name"`
+				Type      string `json:"type"`
+				Artifacts []struct {
+					Path string `json:"path"`
+				} `json:"artifacts"`
+			}
+			if err := json.Unmarshal(targetData, &target); err != nil {
+				continue
+			}
+
+			if target.Type == "EXECUTABLE" && len(target.Artifacts) > 0 {
+				manifest.Targets[target.Name] = target.Artifacts[0].Path
+			}
+		}
+	}
+
+	data, err := json.MarshalIndent(manifest, "", "  ")
+	if err != nil {
+		return nil, fmt.Errorf("failed to encode target manifest: %w", err)
+	}
+	if err := os.WriteFile(filepath.Join(buildDir, targetManifestName), data, 0644); err != nil {
+		return nil, fmt.Errorf("failed to write target manifest: %w", err)
+	}
+
+	return manifest, nil
+}
+
+// executablePaths resolves the manifest into sorted absolute paths of
+// artifacts that exist on disk, applying the same test-binary filter as
+// FindExecutables
+func (m *TargetManifest) executablePaths(buildDir string) []string {
+	var executables []string
+	for name, rel := range m.Targets {
+		if strings.Contains(name, "_test") || strings.Contains(name, "_tests") {
+			continue
+		}
+		path := filepath.Join(buildDir, rel)
+		if _, err := os.Stat(path); err == nil {
+			executables = append(executables, path)
+		}
+	}
+	sort.Strings(executables)
+	return executables
+}
+
+// FindExecutablesCached returns the built executables, served from the
+// target manifest when one is current and rebuilt from the File API reply
+// otherwise. The directory scan remains as a fallback for trees configured
+// before the query file existed.
+func FindExecutablesCached(buildDir string) ([]string, error) {
+	if manifest, ok := LoadTargetManifest(buildDir); ok {
+		if executables := manifest.executablePaths(buildDir); len(executables) > 0 {
+			return executables, nil
+		}
+	}
+
+	if manifest, err := RefreshTargetManifest(buildDir); err == nil {
+		if executables := manifest.executablePaths(buildDir); len(executables) > 0 {
+			return executables, nil
+		}
+	}
+
+	return FindExecutables(buildDir)
+}
@@ -0,0 +1,94 @@
+package build
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// writeFileAPIReply lays out a minimal CMake File API reply with one
+// executable, one library and one test binary
+func writeFileAPIReply(t *testing.T, buildDir string) {
+	t.Helper()
+
+	replyDir := filepath.Join(buildDir, ".cmake", "api", "v1", "reply")
+	require.NoError(t, os.MkdirAll(replyDir, 0755))
+	require.NoError(t, os.WriteFile(filepath.Join(buildDir, "CMakeCache.txt"), []byte("# cache"), 0644))
+
+	files := map[string]string{
+		"index-2026-08-28T12-00-00-0000.json": `{
+			"objects": [{"kind": "codemodel", "jsonFile": "codemodel-v2-abc.json"}]
+		}`,
+		"codemodel-v2-abc.json": `{
+			"configurations": [{"targets": [
+				{"jsonFile": "target-app.json"},
+				{"jsonFile": "target-lib.json"},
+				{"jsonFile": "target-test.json"}
+			]}]
+		}`,
+		"target-app.json": `{
+			"name": "myapp", "type": "EXECUTABLE",
+			"artifacts": [{"path": "myapp"}]
+		}`,
+		"target-lib.json": `{
+			"name": "mylib", "type": "STATIC_LIBRARY",
+			"artifacts": [{"path": "libmylib.a"}]
+		}`,
+		"target-test.json": `{
+			"name": "myapp_tests", "type": "EXECUTABLE",
+			"artifacts": [{"path": "myapp_tests"}]
+		}`,
+	}
+	for name, content := range files {
+		require.NoError(t, os.WriteFile(filepath.Join(replyDir, name), []byte(content), 0644))
+	}
+
+	// The artifacts the manifest points at
+	require.NoError(t, os.WriteFile(filepath.Join(buildDir, "myapp"), []byte("bin"), 0755))
+	require.NoError(t, os.WriteFile(filepath.Join(buildDir, "myapp_tests"), []byte("bin"), 0755))
+}
+
+func TestRefreshAndLoadTargetManifest(t *testing.T) {
+	buildDir := t.TempDir()
+	writeFileAPIReply(t, buildDir)
+
+	manifest, err := RefreshTargetManifest(buildDir)
+	require.NoError(t, err)
+	assert.Equal(t, map[string]string{
+		"myapp":       "myapp",
+		"myapp_tests": "myapp_tests",
+	}, manifest.Targets)
+
+	loaded, ok := LoadTargetManifest(buildDir)
+	require.True(t, ok)
+	assert.Equal(t, manifest.Targets, loaded.Targets)
+
+	// A fresh configure invalidates the manifest via the cache stamp
+	require.NoError(t, os.Remove(filepath.Join(buildDir, "CMakeCache.txt")))
+	_, ok = LoadTargetManifest(buildDir)
+	assert.False(t, ok)
+}
+
+func TestFindExecutablesCached(t *testing.T) {
+	buildDir := t.TempDir()
+	writeFileAPIReply(t, buildDir)
+
+	executables, err := FindExecutablesCached(buildDir)
+	require.NoError(t, err)
+	// Test binaries are filtered out, matching FindExecutables
+	require.Len(t, executables, 1)
+	assert.Equal(t, filepath.Join(buildDir, "myapp"), executables[0])
+}
+
+func TestFindExecutablesCached_FallsBackWithoutReply(t *testing.T) {
+	buildDir := t.TempDir()
+	require.NoError(t, os.WriteFile(filepath.Join(buildDir, "plainapp"), []byte("bin"), 0755))
+
+	executables, err := FindExecutablesCached(buildDir)
+	require.NoError(t, err)
+	require.Len(t, executables, 1)
+	assert.Equal(t, filepath.Join(buildDir, "plainapp"), executables[0])
+}
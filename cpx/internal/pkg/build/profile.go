@@ -0,0 +1,308 @@
+package build
+
+import (
+	"encoding/json"
+	"fmt"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"runtime"
+	"sort"
+	"strings"
+)
+
+// flameNode is one frame in the aggregated call tree embedded into the
+// flamegraph HTML
+type flameNode struct {
+	Name     string       `json:"name"`
+	Value    int          `json:"value"`
+	Children []*flameNode `json:"children,omitempty"`
+}
+
+// CheckProfilingSupport verifies the platform sampler is available.
+// Profiling currently relies on Linux perf; other platforms get a hint
+// rather than a half-working fallback.
+func CheckProfilingSupport() error {
+	if runtime.GOOS != "linux" {
+		return fmt.Errorf("--profile requires Linux perf (current platform: %s)", runtime.GOOS)
+	}
+	if _, err := exec.LookPath("perf"); err != nil {
+		return fmt.Errorf("perf not found in PATH. Install it with your package manager (e.g. apt install linux-perf)")
+	}
+	return nil
+}
+
+// PerfRecordCommand wraps a benchmark invocation in perf record with DWARF
+// call graphs, sampling into dataFile. The child's stdout/stderr pass
+// through untouched, so history tracking keeps working under --profile.
+func PerfRecordCommand(dataFile, benchPath string, benchArgs []string) *exec.Cmd {
+	args := []string{"record", "-g", "--call-graph", "dwarf", "-F", "997", "-o", dataFile, "--", benchPath}
+	args = append(args, benchArgs...)
+	return exec.Command("perf", args...)
+}
+
+// FoldPerfScript collapses `perf script` output into folded stacks, i.e.
+// "main;run;hot_fn" -> sample count, the format flamegraphs are built from
+func FoldPerfScript(output string) map[string]int {
+	folded := make(map[string]int)
+	var frames []string
+
+	flush := func() {
+		if len(frames) == 0 {
+			return
+		}
+		// perf prints leaf-first; fold root-first
+		parts := make([]string, 0, len(frames))
+		for i := len(frames) - 1; i >= 0; i-- {
+			parts = append(parts, frames[i])
+		}
+		folded[strings.Join(parts, ";")]++
+		frames = frames[:0]
+	}
+
+	for _, line := range strings.Split(output, "\n") {
+		trimmed := strings.TrimSpace(line)
+		if trimmed == "" {
+			flush()
+			continue
+		}
+
+		// Stack frame lines are indented: "  55f0c1a2 hot_fn (/path/to/bin)"
+		// Event header lines are not: "bench 1234 567.89: 997 cycles:"
+		if !strings.HasPrefix(line, "\t") && !strings.HasPrefix(line, " ") {
+			flush()
+			continue
+		}
+
+		fields := strings.Fields(trimmed)
+		if len(fields) < 2 {
+			continue
+		}
+
+		// Drop the leading address and the trailing "(dso)" when present
+		symbol := strings.Join(fields[1:], " ")
+		if idx := strings.LastIndex(symbol, " ("); idx > 0 {
+			symbol = symbol[:idx]
+		}
+		if symbol == "" || symbol == "[unknown]" {
+			continue
+		}
+		frames = append(frames, symbol)
+	}
+	flush()
+
+	return folded
+}
+
+// buildFlameTree aggregates folded stacks into a call tree rooted at "all"
+func buildFlameTree(folded map[string]int) *flameNode {
+	root := &flameNode{Name: "all"}
+
+	// Deterministic insertion order so the rendered graph is stable
+	stacks := make([]string, 0, len(folded))
+	for stack := range folded {
+		stacks = append(stacks, stack)
+	}
+	sort.Strings(stacks)
+
+	for _, stack := range stacks {
+		count := folded[stack]
+		root.Value += count
+		node := root
+		for _, frame := range strings.Split(stack, ";") {
+			var child *flameNode
+			for _, c := range node.Children {
+				if c.Name == frame {
+					child = c
+					break
+				}
+			}
+			if child == nil {
+				child = &flameNode{Name: frame}
+				node.Children = append(node.Children, child)
+			}
+			child.Value += count
+			node = child
+		}
+	}
+	return root
+}
+
+// WriteFlamegraphHTML renders the folded stacks as a self-contained
+// interactive flamegraph (click to zoom, hover for counts), matching the
+// standalone HTML reports cpx analyze produces
+func WriteFlamegraphHTML(folded map[string]int, outputFile string) error {
+	if len(folded) == 0 {
+		return fmt.Errorf("no stack samples collected; is the benchmark too short for the sampler?")
+	}
+
+	tree := buildFlameTree(folded)
+	data, err := json.Marshal(tree)
+	if err != nil {
+		return fmt.Errorf("failed to encode flamegraph data: %w", err)
+	}
+
+	html := strings.Replace(flamegraphTemplate, "__FLAME_DATA__", string(data), 1)
+	if err := os.WriteFile(outputFile, []byte(html), 0644); err != nil {
+		return fmt.Errorf("failed to write flamegraph: %w", err)
+	}
+	return nil
+}
+
+// PerfDataFile returns where the raw perf.data for a flamegraph lives; it is
+// kept next to the HTML for ad-hoc `perf report` digging
+func PerfDataFile(outputFile string) string {
+	return strings.TrimSuffix(outputFile, filepath.Ext(outputFile)) + ".perf.data"
+}
+
+// GenerateFlamegraph folds the stacks recorded in dataFile and writes the
+// flamegraph HTML to outputFile
+func GenerateFlamegraph(dataFile, outputFile string) error {
+	scriptCmd := exec.Command("perf", "script", "-i", dataFile)
+	scriptOut, err := scriptCmd.Output()
+	if err != nil {
+		return fmt.Errorf("perf script failed: %w", err)
+	}
+
+	folded := FoldPerfScript(string(scriptOut))
+	if err := WriteFlamegraphHTML(folded, outputFile); err != nil {
+		return err
+	}
+
+	samples := 0
+	for _, count := range folded {
+		samples += count
+	}
+	fmt.Printf("%s✓ Flamegraph written to %s%s %s(%d samples, raw data in %s)%s\n",
+		colorGreen, outputFile, colorReset, colorGray, samples, dataFile, colorReset)
+	return nil
+}
+
+const flamegraphTemplate = `<!DOCTYPE html>
+<html lang="en">
+<head>
+    <meta charset="UTF-8">
+    <meta name="viewport" content="width=device-width, initial-scale=1.0">
+    <title>Cpx Benchmark Flamegraph</title>
+    <style>
+        * { margin: 0; padding: 0; box-sizing: border-box; }
+        body {
+            font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, 'Helvetica Neue', Arial, sans-serif;
+            background: linear-gradient(135deg, #0a0a1a 0%, #1a1a2e 50%, #16213e 100%);
+            background-attachment: fixed;
+            color: #e2e8f0;
+            padding: 20px;
+            min-height: 100vh;
+        }
+        .container {
+            max-width: 1600px;
+            margin: 0 auto;
+            background: rgba(15, 15, 35, 0.8);
+            border: 1px solid rgba(0, 212, 255, 0.2);
+            border-radius: 20px;
+            padding: 40px;
+            box-shadow: 0 20px 60px rgba(0, 0, 0, 0.5);
+        }
+        h1 {
+            background: linear-gradient(135deg, #00d4ff 0%, #00a8cc 100%);
+            -webkit-background-clip: text;
+            -webkit-text-fill-color: transparent;
+            background-clip: text;
+            margin-bottom: 10px;
+            font-size: 2.2em;
+            font-weight: 800;
+        }
+        .hint { color: #94a3b8; font-size: 0.95em; margin-bottom: 24px; }
+        #flame { position: relative; width: 100%; }
+        .frame {
+            position: absolute;
+            height: 18px;
+            line-height: 18px;
+            font-size: 11px;
+            font-family: 'SF Mono', Menlo, Consolas, monospace;
+            overflow: hidden;
+            white-space: nowrap;
+            text-overflow: ellipsis;
+            color: #0a0a1a;
+            border-radius: 2px;
+            cursor: pointer;
+            padding: 0 3px;
+        }
+        .frame:hover { outline: 1px solid #00d4ff; }
+        #status {
+            margin-top: 16px;
+            color: #94a3b8;
+            font-family: 'SF Mono', Menlo, Consolas, monospace;
+            font-size: 12px;
+            min-height: 18px;
+        }
+    </style>
+</head>
+<body>
+    <div class="container">
+        <h1>Benchmark Flamegraph</h1>
+        <div class="hint">Click a frame to zoom in, click the root frame to zoom out. Widths are proportional to sample counts.</div>
+        <div id="flame"></div>
+        <div id="status"></div>
+    </div>
+    <script>
+        const root = __FLAME_DATA__;
+        const flame = document.getElementById('flame');
+        const status = document.getElementById('status');
+        const rowHeight = 19;
+        let zoomed = root;
+
+        function color(name) {
+            let hash = 0;
+            for (let i = 0; i < name.length; i++) hash = (hash * 31 + name.charCodeAt(i)) >>> 0;
+            const hue = 20 + (hash % 40);           // warm flame palette
+            const light = 55 + (hash >> 8) % 15;
+            return 'hsl(' + hue + ', 90%, ' + light + '%)';
+        }
+
+        function depth(node) {
+            let d = 1;
+            for (const c of node.children || []) d = Math.max(d, 1 + depth(c));
+            return d;
+        }
+
+        function render() {
+            flame.innerHTML = '';
+            flame.style.height = (depth(zoomed) * rowHeight) + 'px';
+            const width = flame.clientWidth;
+            layout(zoomed, 0, width, 0);
+        }
+
+        function layout(node, x, w, level) {
+            if (w < 1) return;
+            const div = document.createElement('div');
+            div.className = 'frame';
+            div.style.left = x + 'px';
+            div.style.width = Math.max(w - 1, 1) + 'px';
+            div.style.top = (level * rowHeight) + 'px';
+            div.style.background = color(node.name);
+            div.textContent = node.name;
+            div.onclick = function() {
+                zoomed = (node === zoomed) ? root : node;
+                render();
+            };
+            div.onmouseenter = function() {
+                const pct = (100 * node.value / root.value).toFixed(2);
+                status.textContent = node.name + ' — ' + node.value + ' samples (' + pct + '% of total)';
+            };
+            flame.appendChild(div);
+
+            let childX = x;
+            for (const c of node.children || []) {
+                const childW = w * c.value / node.value;
+                layout(c, childX, childW, level + 1);
+                childX += childW;
+            }
+        }
+
+        window.addEventListener('resize', render);
+        render();
+    </script>
+</body>
+</html>
+`
@@ -0,0 +1,76 @@
+package build
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestFoldPerfScript(t *testing.T) {
+	output := `bench 12345 1000.123456:     997010 cycles:
+	    55f0c1a2b3c4 hot_fn (/tmp/bench)
+	    55f0c1a2b000 run (/tmp/bench)
+	    55f0c1a29000 main (/tmp/bench)
+
+bench 12345 1000.234567:     997010 cycles:
+	    55f0c1a2b3c4 hot_fn (/tmp/bench)
+	    55f0c1a2b000 run (/tmp/bench)
+	    55f0c1a29000 main (/tmp/bench)
+
+bench 12345 1000.345678:     997010 cycles:
+	    55f0c1a2c000 cold_fn (/tmp/bench)
+	    55f0c1a29000 main (/tmp/bench)
+`
+
+	folded := FoldPerfScript(output)
+	require.Len(t, folded, 2)
+	assert.Equal(t, 2, folded["main;run;hot_fn"])
+	assert.Equal(t, 1, folded["main;cold_fn"])
+}
+
+func TestFoldPerfScript_SkipsUnknownFrames(t *testing.T) {
+	output := `bench 1 1.0: 1 cycles:
+	    ffffffffa0000000 [unknown] ([kernel.kallsyms])
+	    55f0c1a2b3c4 hot_fn (/tmp/bench)
+	    55f0c1a29000 main (/tmp/bench)
+`
+
+	folded := FoldPerfScript(output)
+	require.Len(t, folded, 1)
+	assert.Equal(t, 1, folded["main;hot_fn"])
+}
+
+func TestBuildFlameTree(t *testing.T) {
+	folded := map[string]int{
+		"main;run;hot_fn": 3,
+		"main;cold_fn":    1,
+	}
+
+	root := buildFlameTree(folded)
+	assert.Equal(t, "all", root.Name)
+	assert.Equal(t, 4, root.Value)
+	require.Len(t, root.Children, 1)
+
+	main := root.Children[0]
+	assert.Equal(t, "main", main.Name)
+	assert.Equal(t, 4, main.Value)
+	assert.Len(t, main.Children, 2)
+}
+
+func TestWriteFlamegraphHTML(t *testing.T) {
+	outputFile := filepath.Join(t.TempDir(), "flamegraph.html")
+
+	err := WriteFlamegraphHTML(map[string]int{"main;hot_fn": 5}, outputFile)
+	require.NoError(t, err)
+
+	data, err := os.ReadFile(outputFile)
+	require.NoError(t, err)
+	assert.Contains(t, string(data), "hot_fn")
+	assert.NotContains(t, string(data), "__FLAME_DATA__")
+
+	err = WriteFlamegraphHTML(map[string]int{}, outputFile)
+	assert.Error(t, err)
+}
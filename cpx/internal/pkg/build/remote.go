@@ -0,0 +1,53 @@
+package build
+
+import (
+	"fmt"
+	"os"
+	"os/exec"
+	"runtime"
+	"strconv"
+	"strings"
+)
+
+// DetectRemoteLauncher returns the distributed-compile wrapper to use for
+// --remote builds. CPX_REMOTE_LAUNCHER overrides detection; otherwise the
+// first of distcc/icecc found in PATH is used.
+func DetectRemoteLauncher() (string, error) {
+	if launcher := os.Getenv("CPX_REMOTE_LAUNCHER"); launcher != "" {
+		return launcher, nil
+	}
+	for _, candidate := range []string{"distcc", "icecc"} {
+		if _, err := exec.LookPath(candidate); err == nil {
+			return candidate, nil
+		}
+	}
+	return "", fmt.Errorf("no remote compile launcher found (install distcc or icecream, or set CPX_REMOTE_LAUNCHER)")
+}
+
+// RemoteLauncherArgs returns the CMake arguments that route compilation
+// through the remote launcher. When a compiler cache is also available the
+// two are chained (cache first, so local hits never leave the machine).
+func RemoteLauncherArgs(remoteLauncher string) []string {
+	launcher := remoteLauncher
+	if cache := DetectCompilerLauncher(); cache != "" {
+		launcher = cache + ";" + remoteLauncher
+	}
+	return []string{
+		"-DCMAKE_C_COMPILER_LAUNCHER=" + launcher,
+		"-DCMAKE_CXX_COMPILER_LAUNCHER=" + launcher,
+	}
+}
+
+// RemoteJobs returns the parallelism for a remote build. Local core count
+// would leave the farm idle, so distcc is asked for its total slot count;
+// when that is unavailable the local count is oversubscribed instead.
+func RemoteJobs(launcher string) int {
+	if launcher == "distcc" {
+		if out, err := exec.Command("distcc", "-j").Output(); err == nil {
+			if n, err := strconv.Atoi(strings.TrimSpace(string(out))); err == nil && n > 0 {
+				return n
+			}
+		}
+	}
+	return 4 * runtime.NumCPU()
+}
@@ -0,0 +1,42 @@
+package build
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestDetectRemoteLauncher(t *testing.T) {
+	t.Run("Env override", func(t *testing.T) {
+		t.Setenv("CPX_REMOTE_LAUNCHER", "distcc")
+		launcher, err := DetectRemoteLauncher()
+		require.NoError(t, err)
+		assert.Equal(t, "distcc", launcher)
+	})
+}
+
+func TestRemoteLauncherArgs(t *testing.T) {
+	t.Run("Chained with compiler cache", func(t *testing.T) {
+		t.Setenv("CPX_COMPILER_LAUNCHER", "ccache")
+		args := RemoteLauncherArgs("distcc")
+		assert.Equal(t, []string{
+			"-DCMAKE_C_COMPILER_LAUNCHER=ccache;distcc",
+			"-DCMAKE_CXX_COMPILER_LAUNCHER=ccache;distcc",
+		}, args)
+	})
+
+	t.Run("Without compiler cache", func(t *testing.T) {
+		t.Setenv("CPX_COMPILER_LAUNCHER", "none")
+		args := RemoteLauncherArgs("icecc")
+		assert.Equal(t, []string{
+			"-DCMAKE_C_COMPILER_LAUNCHER=icecc",
+			"-DCMAKE_CXX_COMPILER_LAUNCHER=icecc",
+		}, args)
+	})
+}
+
+func TestRemoteJobs_Fallback(t *testing.T) {
+	// icecc has no slot-count query, so the local count is oversubscribed
+	assert.Greater(t, RemoteJobs("icecc"), 0)
+}
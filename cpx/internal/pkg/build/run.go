@@ -98,18 +98,14 @@ func RunProject(release bool, target string, execArgs []string, verbose bool, op
 		colorGray, optLabel, colorReset)
 
 	// Configure CMake if needed
-	outDirName := "debug"
-	if optLevel != "" {
-		outDirName = "O" + optLevel
-	} else if release {
-		outDirName = "release"
-	}
-	// Append sanitizer suffix
-	if sanitizer != "" {
-		outDirName += "-" + sanitizer
-	}
+	outDirName := VariantDirName(release, optLevel, sanitizer)
 	cacheBuildDir := filepath.Join(".cache", "native", outDirName)
 	finalBuildDir := filepath.Join(".bin", "native", outDirName)
+
+	// Ask CMake for a target reply on the next configure, so executables are
+	// listed from the manifest instead of a build-tree walk
+	EnableCMakeFileAPI(cacheBuildDir)
+
 	needsConfigure := false
 	if _, err := os.Stat(filepath.Join(cacheBuildDir, "CMakeCache.txt")); os.IsNotExist(err) {
 		needsConfigure = true
@@ -145,6 +141,7 @@ func RunProject(release bool, target string, execArgs []string, verbose bool, op
 			if linkerFlags != "" {
 				cmdArgs = append(cmdArgs, "-DCMAKE_EXE_LINKER_FLAGS="+linkerFlags, "-DCMAKE_SHARED_LINKER_FLAGS="+linkerFlags)
 			}
+			cmdArgs = append(cmdArgs, CompilerLauncherArgs()...)
 			cmd := exec.Command("cmake", cmdArgs...)
 			cmd.Env = os.Environ()
 			if err := runCMakeConfigure(cmd, verbose); err != nil {
@@ -160,6 +157,7 @@ func RunProject(release bool, target string, execArgs []string, verbose bool, op
 			if linkerFlags != "" {
 				cmdArgs = append(cmdArgs, "-DCMAKE_EXE_LINKER_FLAGS="+linkerFlags, "-DCMAKE_SHARED_LINKER_FLAGS="+linkerFlags)
 			}
+			cmdArgs = append(cmdArgs, CompilerLauncherArgs()...)
 			cmd := exec.Command("cmake", cmdArgs...)
 			if err := runCMakeConfigure(cmd, verbose); err != nil {
 				fmt.Println()
@@ -190,7 +188,7 @@ func RunProject(release bool, target string, execArgs []string, verbose bool, op
 		return fmt.Errorf("failed to create final build dir: %w", err)
 	}
 
-	executables, err := FindExecutables(cacheBuildDir)
+	executables, err := FindExecutablesCached(cacheBuildDir)
 	if err == nil {
 		for _, exe := range executables {
 			dest := filepath.Join(finalBuildDir, filepath.Base(exe))
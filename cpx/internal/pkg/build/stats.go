@@ -0,0 +1,224 @@
+package build
+
+import (
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strconv"
+	"strings"
+	"time"
+)
+
+// BuildTargetStat is the recorded cost of one build target (a Ninja output):
+// its wall time and whether this run got it from the incremental cache
+type BuildTargetStat struct {
+	Name       string  `json:"name"`
+	DurationMs float64 `json:"duration_ms"`
+	CacheHit   bool    `json:"cache_hit"`
+}
+
+// BuildStatsRun is one build's telemetry as stored under .cpx/build-stats
+type BuildStatsRun struct {
+	Timestamp time.Time         `json:"timestamp"`
+	Variant   string            `json:"variant"`
+	TotalMs   float64           `json:"total_ms"`
+	Targets   []BuildTargetStat `json:"targets"`
+}
+
+// buildStatsDir is where per-run build telemetry lives
+func buildStatsDir() string {
+	return filepath.Join(".cpx", "build-stats")
+}
+
+// SnapshotNinjaLog returns the current size of the build directory's
+// .ninja_log, taken before a build so entries appended by that build can be
+// told apart from earlier runs. Returns 0 when the log does not exist yet.
+func SnapshotNinjaLog(buildDir string) int64 {
+	info, err := os.Stat(filepath.Join(buildDir, ".ninja_log"))
+	if err != nil {
+		return 0
+	}
+	return info.Size()
+}
+
+// CollectNinjaStats parses the build directory's .ninja_log into per-target
+// stats. Entries appended after offset were rebuilt by this run; targets
+// whose latest entry predates it were served from the incremental cache.
+func CollectNinjaStats(buildDir string, offset int64) ([]BuildTargetStat, error) {
+	logPath := filepath.Join(buildDir, ".ninja_log")
+	data, err := os.ReadFile(logPath)
+	if err != nil {
+		return nil, fmt.Errorf("no .ninja_log in %s (build stats need the Ninja generator): %w", buildDir, err)
+	}
+
+	// Lines are "start_ms<TAB>end_ms<TAB>mtime<TAB>output<TAB>hash"; later
+	// entries for the same output supersede earlier ones
+	latest := make(map[string]BuildTargetStat)
+	var pos int64
+	for _, line := range strings.SplitAfter(string(data), "\n") {
+		lineStart := pos
+		pos += int64(len(line))
+
+		line = strings.TrimRight(line, "\n")
+		if line == "" || strings.HasPrefix(line, "#") {
+			continue
+		}
+		fields := strings.Split(line, "\t")
+		if len(fields) < 4 {
+			continue
+		}
+		start, err1 := strconv.ParseFloat(fields[0], 64)
+		end, err2 := strconv.ParseFloat(fields[1], 64)
+		if err1 != nil || err2 != nil || end < start {
+			continue
+		}
+		latest[fields[3]] = BuildTargetStat{
+			Name:       fields[3],
+			DurationMs: end - start,
+			CacheHit:   lineStart < offset,
+		}
+	}
+
+	if len(latest) == 0 {
+		return nil, fmt.Errorf("no build entries in %s", logPath)
+	}
+
+	stats := make([]BuildTargetStat, 0, len(latest))
+	for _, stat := range latest {
+		stats = append(stats, stat)
+	}
+	sort.Slice(stats, func(i, j int) bool { return stats[i].DurationMs > stats[j].DurationMs })
+	return stats, nil
+}
+
+// SaveBuildStats stores a run as a timestamped file under .cpx/build-stats
+// and returns its path
+func SaveBuildStats(run BuildStatsRun) (string, error) {
+	dir := buildStatsDir()
+	if err := os.MkdirAll(dir, 0755); err != nil {
+		return "", fmt.Errorf("failed to create build stats dir: %w", err)
+	}
+
+	data, err := json.MarshalIndent(run, "", "  ")
+	if err != nil {
+		return "", fmt.Errorf("failed to encode build stats: %w", err)
+	}
+
+	path := filepath.Join(dir, run.Timestamp.UTC().Format("20060102-150405")+".json")
+	if err := os.WriteFile(path, data, 0644); err != nil {
+		return "", fmt.Errorf("failed to write build stats: %w", err)
+	}
+	return path, nil
+}
+
+// LoadBuildStatsHistory returns all stored runs, oldest first
+func LoadBuildStatsHistory() ([]BuildStatsRun, error) {
+	entries, err := os.ReadDir(buildStatsDir())
+	if err != nil {
+		return nil, nil // No history yet
+	}
+
+	var names []string
+	for _, entry := range entries {
+		if strings.HasSuffix(entry.Name(), ".json") {
+			names = append(names, entry.Name())
+		}
+	}
+	sort.Strings(names) // Timestamped names sort chronologically
+
+	var history []BuildStatsRun
+	for _, name := range names {
+		data, err := os.ReadFile(filepath.Join(buildStatsDir(), name))
+		if err != nil {
+			continue
+		}
+		var run BuildStatsRun
+		if err := json.Unmarshal(data, &run); err != nil {
+			continue
+		}
+		history = append(history, run)
+	}
+	return history, nil
+}
+
+// PrintBuildStats prints the slowest targets of a run with cache-hit markers
+func PrintBuildStats(run BuildStatsRun, topN int) {
+	rebuilt := 0
+	for _, stat := range run.Targets {
+		if !stat.CacheHit {
+			rebuilt++
+		}
+	}
+
+	fmt.Printf("\n%s▸ Build stats%s %s[%s] %d targets, %d rebuilt, %d cached%s\n",
+		colorCyan, colorReset, colorGray, run.Variant, len(run.Targets), rebuilt, len(run.Targets)-rebuilt, colorReset)
+	fmt.Printf("  Slowest targets:\n")
+	for i, stat := range run.Targets {
+		if i == topN {
+			break
+		}
+		marker := " "
+		if stat.CacheHit {
+			marker = colorGray + "cached" + colorReset
+		}
+		fmt.Printf("    %8.0fms  %-60s %s\n", stat.DurationMs, stat.Name, marker)
+	}
+}
+
+// PrintBuildStatsTrend prints total build cost across stored runs so
+// regressions in the build budget stand out
+func PrintBuildStatsTrend(history []BuildStatsRun) {
+	if len(history) < 2 {
+		return
+	}
+	// Show the most recent runs only
+	if len(history) > 10 {
+		history = history[len(history)-10:]
+	}
+
+	fmt.Printf("\n  Trend (last %d runs):\n", len(history))
+	var prevMs float64
+	for i, run := range history {
+		delta := ""
+		if i > 0 && prevMs > 0 {
+			pct := (run.TotalMs - prevMs) / prevMs * 100
+			delta = fmt.Sprintf("%+6.1f%%", pct)
+		}
+		fmt.Printf("    %s  %-14s %10.0fms  %s\n",
+			run.Timestamp.Local().Format("2006-01-02 15:04"), run.Variant, run.TotalMs, delta)
+		prevMs = run.TotalMs
+	}
+}
+
+// RecordBuildStats collects this run's Ninja telemetry, persists it and
+// prints the slowest-targets report with the cross-run trend. Failures are
+// reported as a warning, not an error: stats must never fail a good build.
+func RecordBuildStats(buildDir, variant string, offset int64) {
+	stats, err := CollectNinjaStats(buildDir, offset)
+	if err != nil {
+		fmt.Printf("%s  ⚠ build stats unavailable: %v%s\n", "\033[33m", err, "\033[0m")
+		return
+	}
+
+	run := BuildStatsRun{
+		Timestamp: time.Now(),
+		Variant:   variant,
+		Targets:   stats,
+	}
+	for _, stat := range stats {
+		if !stat.CacheHit {
+			run.TotalMs += stat.DurationMs
+		}
+	}
+
+	if _, err := SaveBuildStats(run); err != nil {
+		fmt.Printf("%s  ⚠ failed to save build stats: %v%s\n", "\033[33m", err, "\033[0m")
+	}
+
+	PrintBuildStats(run, 15)
+	if history, err := LoadBuildStatsHistory(); err == nil {
+		PrintBuildStatsTrend(history)
+	}
+}
@@ -0,0 +1,125 @@
+package build
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+const sampleNinjaLog = `# ninja log v5
+0	1500	100	src/main.cpp.o	abc1
+100	400	100	src/util.cpp.o	abc2
+0	2000	200	app	abc3
+`
+
+func TestCollectNinjaStats(t *testing.T) {
+	buildDir := t.TempDir()
+	logPath := filepath.Join(buildDir, ".ninja_log")
+	require.NoError(t, os.WriteFile(logPath, []byte(sampleNinjaLog), 0644))
+
+	// Offset 0 means everything was rebuilt by this run
+	stats, err := CollectNinjaStats(buildDir, 0)
+	require.NoError(t, err)
+	require.Len(t, stats, 3)
+
+	// Sorted by duration, slowest first
+	assert.Equal(t, "app", stats[0].Name)
+	assert.InDelta(t, 2000.0, stats[0].DurationMs, 0.01)
+	assert.Equal(t, "src/main.cpp.o", stats[1].Name)
+	assert.Equal(t, "src/util.cpp.o", stats[2].Name)
+	for _, stat := range stats {
+		assert.False(t, stat.CacheHit)
+	}
+}
+
+func TestCollectNinjaStats_CacheHits(t *testing.T) {
+	buildDir := t.TempDir()
+	logPath := filepath.Join(buildDir, ".ninja_log")
+	require.NoError(t, os.WriteFile(logPath, []byte(sampleNinjaLog), 0644))
+
+	// Snapshot the log, then append one rebuilt entry as Ninja would
+	offset := SnapshotNinjaLog(buildDir)
+	file, err := os.OpenFile(logPath, os.O_APPEND|os.O_WRONLY, 0644)
+	require.NoError(t, err)
+	_, err = file.WriteString("0\t800\t300\tsrc/main.cpp.o\tdef1\n")
+	require.NoError(t, err)
+	require.NoError(t, file.Close())
+
+	stats, err := CollectNinjaStats(buildDir, offset)
+	require.NoError(t, err)
+	require.Len(t, stats, 3)
+
+	byName := make(map[string]BuildTargetStat)
+	for _, stat := range stats {
+		byName[stat.Name] = stat
+	}
+
+	// The appended entry supersedes the old one and counts as rebuilt
+	assert.False(t, byName["src/main.cpp.o"].CacheHit)
+	assert.InDelta(t, 800.0, byName["src/main.cpp.o"].DurationMs, 0.01)
+
+	// Targets untouched by this run are cache hits
+	assert.True(t, byName["src/util.cpp.o"].CacheHit)
+	assert.True(t, byName["app"].CacheHit)
+}
+
+func TestCollectNinjaStats_NoLog(t *testing.T) {
+	_, err := CollectNinjaStats(t.TempDir(), 0)
+	assert.Error(t, err)
+	assert.Contains(t, err.Error(), "Ninja generator")
+}
+
+func TestBuildStatsHistoryRoundTrip(t *testing.T) {
+	oldWd, err := os.Getwd()
+	require.NoError(t, err)
+	require.NoError(t, os.Chdir(t.TempDir()))
+	defer os.Chdir(oldWd)
+
+	first := BuildStatsRun{
+		Timestamp: time.Date(2026, 1, 2, 10, 0, 0, 0, time.UTC),
+		Variant:   "debug",
+		TotalMs:   3500,
+		Targets: []BuildTargetStat{
+			{Name: "src/main.cpp.o", DurationMs: 3500},
+		},
+	}
+	second := BuildStatsRun{
+		Timestamp: time.Date(2026, 1, 2, 11, 0, 0, 0, time.UTC),
+		Variant:   "debug",
+		TotalMs:   800,
+		Targets: []BuildTargetStat{
+			{Name: "src/main.cpp.o", DurationMs: 800},
+			{Name: "app", DurationMs: 2000, CacheHit: true},
+		},
+	}
+
+	_, err = SaveBuildStats(first)
+	require.NoError(t, err)
+	_, err = SaveBuildStats(second)
+	require.NoError(t, err)
+
+	history, err := LoadBuildStatsHistory()
+	require.NoError(t, err)
+	require.Len(t, history, 2)
+
+	// Oldest first
+	assert.InDelta(t, 3500.0, history[0].TotalMs, 0.01)
+	assert.InDelta(t, 800.0, history[1].TotalMs, 0.01)
+	require.Len(t, history[1].Targets, 2)
+	assert.True(t, history[1].Targets[1].CacheHit)
+}
+
+func TestLoadBuildStatsHistory_Empty(t *testing.T) {
+	oldWd, err := os.Getwd()
+	require.NoError(t, err)
+	require.NoError(t, os.Chdir(t.TempDir()))
+	defer os.Chdir(oldWd)
+
+	history, err := LoadBuildStatsHistory()
+	require.NoError(t, err)
+	assert.Empty(t, history)
+}
@@ -5,12 +5,13 @@ import (
 	"os"
 	"os/exec"
 	"path/filepath"
+	"runtime"
 
 	"github.com/ozacod/cpx/internal/pkg/vcpkg"
 )
 
 // RunTests runs the project tests
-func RunTests(verbose bool, filter string, vcpkgClient *vcpkg.Client) error {
+func RunTests(verbose bool, filter string, release bool, sanitizer string, jobs int, shard int, shards int, vcpkgClient *vcpkg.Client) error {
 	// Set VCPKG_ROOT from cpx config if not already set
 	if err := vcpkgClient.SetupEnv(); err != nil {
 		return err
@@ -22,9 +23,15 @@ func RunTests(verbose bool, filter string, vcpkgClient *vcpkg.Client) error {
 	}
 	fmt.Printf("%s Running tests for '%s'...%s\n", "\033[36m", projectName, "\033[0m")
 
-	// Default to debug for tests if no config specified
-	// Use .cache/native/debug for building tests
-	buildDir := filepath.Join(".cache", "native", "debug")
+	// Tests default to debug, but reuse the matching per-configuration build
+	// tree when a flavor is requested so a warm `cpx build --sanitizer asan`
+	// tree also serves `cpx test --sanitizer asan`
+	buildType, cxxFlags := DetermineBuildType(release, "")
+	sanCFlags, sanLFlags := GetSanitizerFlags(sanitizer)
+	cxxFlags += sanCFlags
+	linkerFlags := sanLFlags
+
+	buildDir := filepath.Join(".cache", "native", VariantDirName(release, "", sanitizer))
 
 	// Check if configure is needed
 	needsConfigure := false
@@ -56,7 +63,14 @@ func RunTests(verbose bool, filter string, vcpkgClient *vcpkg.Client) error {
 		// Check if CMakePresets.json exists, use preset if available
 		if _, err := os.Stat("CMakePresets.json"); err == nil {
 			// Use "default" preset (VCPKG_ROOT is now set from config)
-			cmd := exec.Command("cmake", "--preset=default", "-B", buildDir, vcpkgInstallArg)
+			cmdArgs := []string{"--preset=default", "-B", buildDir, vcpkgInstallArg}
+			if cxxFlags != "" {
+				cmdArgs = append(cmdArgs, "-DCMAKE_CXX_FLAGS="+cxxFlags, "-DCMAKE_C_FLAGS="+cxxFlags)
+			}
+			if linkerFlags != "" {
+				cmdArgs = append(cmdArgs, "-DCMAKE_EXE_LINKER_FLAGS="+linkerFlags, "-DCMAKE_SHARED_LINKER_FLAGS="+linkerFlags)
+			}
+			cmd := exec.Command("cmake", cmdArgs...)
 			cmd.Env = os.Environ()
 			if err := runCMakeConfigure(cmd, verbose); err != nil {
 				fmt.Println()
@@ -64,7 +78,14 @@ func RunTests(verbose bool, filter string, vcpkgClient *vcpkg.Client) error {
 			}
 		} else {
 			// Fallback to traditional cmake configure
-			cmd := exec.Command("cmake", "-B", buildDir, vcpkgInstallArg)
+			cmdArgs := []string{"-B", buildDir, "-DCMAKE_BUILD_TYPE=" + buildType, vcpkgInstallArg}
+			if cxxFlags != "" {
+				cmdArgs = append(cmdArgs, "-DCMAKE_CXX_FLAGS="+cxxFlags, "-DCMAKE_C_FLAGS="+cxxFlags)
+			}
+			if linkerFlags != "" {
+				cmdArgs = append(cmdArgs, "-DCMAKE_EXE_LINKER_FLAGS="+linkerFlags, "-DCMAKE_SHARED_LINKER_FLAGS="+linkerFlags)
+			}
+			cmd := exec.Command("cmake", cmdArgs...)
 			if err := runCMakeConfigure(cmd, verbose); err != nil {
 				fmt.Println()
 				return fmt.Errorf("cmake configure failed: %w", err)
@@ -93,6 +114,12 @@ func RunTests(verbose bool, filter string, vcpkgClient *vcpkg.Client) error {
 
 	ctestArgs := []string{"--test-dir", buildDir}
 
+	// Fan tests out across cores; ctest runs serially by default
+	if jobs == 0 {
+		jobs = runtime.NumCPU()
+	}
+	ctestArgs = append(ctestArgs, "--parallel", fmt.Sprintf("%d", jobs))
+
 	if verbose {
 		ctestArgs = append(ctestArgs, "--verbose")
 	}
@@ -104,6 +131,13 @@ func RunTests(verbose bool, filter string, vcpkgClient *vcpkg.Client) error {
 	}
 
 	ctestCmd := exec.Command("ctest", ctestArgs...)
+	// GoogleTest sharding for CI fan-out: each machine runs one slice of the
+	// test binary, selected via the environment gtest reads at startup
+	if shards > 0 {
+		ctestCmd.Env = append(os.Environ(),
+			fmt.Sprintf("GTEST_TOTAL_SHARDS=%d", shards),
+			fmt.Sprintf("GTEST_SHARD_INDEX=%d", shard))
+	}
 	ctestCmd.Stdout = os.Stdout
 	ctestCmd.Stderr = os.Stderr
 
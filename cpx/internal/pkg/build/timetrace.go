@@ -0,0 +1,282 @@
+package build
+
+import (
+	"encoding/json"
+	"fmt"
+	"html/template"
+	"io/fs"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"time"
+)
+
+// GetTimeTraceFlags returns the CXX flags that make the compiler emit a
+// per-TU compile-time profile. -ftime-trace is a clang feature; gcc only
+// offers unstructured -ftime-report text, so the report requires clang.
+func GetTimeTraceFlags() string {
+	return " -ftime-trace"
+}
+
+// TimeTraceEntry is one aggregated row of the compile-time report: a TU,
+// header, template instantiation or function, with its total cost across
+// the whole build
+type TimeTraceEntry struct {
+	Name    string
+	TotalMs float64
+	Count   int
+}
+
+// TimeTraceReport aggregates every per-TU trace found in a build directory
+type TimeTraceReport struct {
+	Timestamp time.Time
+	TUs       []TimeTraceEntry
+	Headers   []TimeTraceEntry
+	Templates []TimeTraceEntry
+	Functions []TimeTraceEntry
+	TotalMs   float64
+}
+
+// timeTraceFile mirrors the parts of clang's -ftime-trace JSON we aggregate
+type timeTraceFile struct {
+	TraceEvents []struct {
+		Name string  `json:"name"`
+		Dur  float64 `json:"dur"` // microseconds
+		Args struct {
+			Detail string `json:"detail"`
+		} `json:"args"`
+	} `json:"traceEvents"`
+}
+
+// Cap each report section; beyond this the tail is noise
+const timeTraceTopN = 30
+
+// CollectTimeTraces walks the build directory for -ftime-trace JSON files
+// and aggregates them into one report ranking the most expensive TUs,
+// headers, template instantiations and functions
+func CollectTimeTraces(buildDir string) (*TimeTraceReport, error) {
+	report := &TimeTraceReport{Timestamp: time.Now()}
+	headers := make(map[string]*TimeTraceEntry)
+	templates := make(map[string]*TimeTraceEntry)
+	functions := make(map[string]*TimeTraceEntry)
+
+	err := filepath.WalkDir(buildDir, func(path string, d fs.DirEntry, err error) error {
+		if err != nil || d.IsDir() || !strings.HasSuffix(path, ".json") {
+			return nil
+		}
+		// CMake writes its own JSON (file API replies, compile_commands);
+		// parseTimeTrace rejects anything without traceEvents
+		trace, ok := parseTimeTrace(path)
+		if !ok {
+			return nil
+		}
+
+		tuMs := 0.0
+		for _, event := range trace.TraceEvents {
+			ms := event.Dur / 1000.0
+			switch event.Name {
+			case "ExecuteCompiler":
+				tuMs += ms
+			case "Source":
+				accumulate(headers, event.Args.Detail, ms)
+			case "InstantiateClass", "InstantiateFunction":
+				accumulate(templates, event.Args.Detail, ms)
+			case "CodeGen Function":
+				accumulate(functions, event.Args.Detail, ms)
+			}
+		}
+		if tuMs > 0 {
+			tuName := strings.TrimSuffix(filepath.Base(path), ".json")
+			report.TUs = append(report.TUs, TimeTraceEntry{Name: tuName, TotalMs: tuMs, Count: 1})
+			report.TotalMs += tuMs
+		}
+		return nil
+	})
+	if err != nil {
+		return nil, fmt.Errorf("failed to scan %s for traces: %w", buildDir, err)
+	}
+
+	if len(report.TUs) == 0 {
+		return nil, fmt.Errorf("no -ftime-trace output found in %s (time-trace requires clang)", buildDir)
+	}
+
+	sort.Slice(report.TUs, func(i, j int) bool { return report.TUs[i].TotalMs > report.TUs[j].TotalMs })
+	if len(report.TUs) > timeTraceTopN {
+		report.TUs = report.TUs[:timeTraceTopN]
+	}
+	report.Headers = topEntries(headers)
+	report.Templates = topEntries(templates)
+	report.Functions = topEntries(functions)
+
+	return report, nil
+}
+
+// parseTimeTrace reads one JSON file, reporting ok=false for files that are
+// not clang time traces
+func parseTimeTrace(path string) (*timeTraceFile, bool) {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return nil, false
+	}
+	var trace timeTraceFile
+	if err := json.Unmarshal(data, &trace); err != nil || len(trace.TraceEvents) == 0 {
+		return nil, false
+	}
+	return &trace, true
+}
+
+func accumulate(entries map[string]*TimeTraceEntry, name string, ms float64) {
+	if name == "" {
+		return
+	}
+	if entry, ok := entries[name]; ok {
+		entry.TotalMs += ms
+		entry.Count++
+		return
+	}
+	entries[name] = &TimeTraceEntry{Name: name, TotalMs: ms, Count: 1}
+}
+
+// topEntries sorts an aggregation map by total cost and keeps the head
+func topEntries(entries map[string]*TimeTraceEntry) []TimeTraceEntry {
+	sorted := make([]TimeTraceEntry, 0, len(entries))
+	for _, entry := range entries {
+		sorted = append(sorted, *entry)
+	}
+	sort.Slice(sorted, func(i, j int) bool { return sorted[i].TotalMs > sorted[j].TotalMs })
+	if len(sorted) > timeTraceTopN {
+		sorted = sorted[:timeTraceTopN]
+	}
+	return sorted
+}
+
+// PrintTimeTraceSummary prints the head of each report section to the
+// terminal so the worst offenders are visible without opening the HTML
+func PrintTimeTraceSummary(report *TimeTraceReport) {
+	fmt.Printf("\n%s▸ Compile-time profile%s %s(total compiler time: %s)%s\n",
+		colorCyan, colorReset, colorGray, time.Duration(report.TotalMs*float64(time.Millisecond)).Round(10*time.Millisecond), colorReset)
+
+	printTraceSection := func(title string, entries []TimeTraceEntry) {
+		if len(entries) == 0 {
+			return
+		}
+		fmt.Printf("  %s:\n", title)
+		for i, entry := range entries {
+			if i == 5 {
+				break
+			}
+			fmt.Printf("    %8.0fms  %s\n", entry.TotalMs, entry.Name)
+		}
+	}
+	printTraceSection("Slowest TUs", report.TUs)
+	printTraceSection("Most expensive headers", report.Headers)
+	printTraceSection("Most expensive template instantiations", report.Templates)
+	printTraceSection("Most expensive functions", report.Functions)
+}
+
+// WriteTimeTraceReport renders the aggregated traces as a standalone HTML
+// report, following the same inline-template approach as the quality
+// analysis report
+func WriteTimeTraceReport(report *TimeTraceReport, outputFile string) error {
+	htmlTemplate := `<!DOCTYPE html>
+<html lang="en">
+<head>
+    <meta charset="UTF-8">
+    <title>Compile-Time Report</title>
+    <style>
+        body { font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', sans-serif; margin: 0; background: #f5f5f5; color: #333; }
+        .container { max-width: 1100px; margin: 0 auto; padding: 24px; }
+        h1 { margin: 0 0 4px 0; }
+        .meta { color: #777; margin-bottom: 24px; }
+        h2 { border-bottom: 2px solid #ddd; padding-bottom: 6px; margin-top: 32px; }
+        table { width: 100%; border-collapse: collapse; background: #fff; box-shadow: 0 1px 3px rgba(0,0,0,0.1); }
+        th, td { text-align: left; padding: 8px 12px; border-bottom: 1px solid #eee; }
+        th { background: #fafafa; }
+        td.num { text-align: right; font-variant-numeric: tabular-nums; white-space: nowrap; }
+        td.name { font-family: monospace; font-size: 13px; word-break: break-all; }
+        .bar { display: inline-block; height: 8px; background: #4a90d9; border-radius: 2px; vertical-align: middle; }
+    </style>
+</head>
+<body>
+    <div class="container">
+        <h1>Compile-Time Report</h1>
+        <div class="meta">Generated {{.Timestamp.Format "2006-01-02 15:04:05"}} &mdash; total compiler time {{printf "%.1f" .TotalMs}}ms</div>
+        {{template "section" dict "Title" "Slowest Translation Units" "Entries" .TUs "Max" .MaxTU}}
+        {{template "section" dict "Title" "Most Expensive Headers" "Entries" .Headers "Max" .MaxHeader}}
+        {{template "section" dict "Title" "Most Expensive Template Instantiations" "Entries" .Templates "Max" .MaxTemplate}}
+        {{template "section" dict "Title" "Most Expensive Functions" "Entries" .Functions "Max" .MaxFunction}}
+    </div>
+</body>
+</html>
+{{define "section"}}
+        {{if .Entries}}
+        <h2>{{.Title}}</h2>
+        <table>
+            <tr><th>Name</th><th style="text-align:right">Total</th><th style="text-align:right">Count</th><th style="width:30%"></th></tr>
+            {{$max := .Max}}
+            {{range .Entries}}
+            <tr>
+                <td class="name">{{.Name}}</td>
+                <td class="num">{{printf "%.1f" .TotalMs}}ms</td>
+                <td class="num">{{.Count}}</td>
+                <td><span class="bar" style="width: {{barWidth .TotalMs $max}}%"></span></td>
+            </tr>
+            {{end}}
+        </table>
+        {{end}}
+{{end}}`
+
+	funcs := template.FuncMap{
+		"dict": func(pairs ...interface{}) map[string]interface{} {
+			m := make(map[string]interface{}, len(pairs)/2)
+			for i := 0; i+1 < len(pairs); i += 2 {
+				m[pairs[i].(string)] = pairs[i+1]
+			}
+			return m
+		},
+		"barWidth": func(ms, max float64) int {
+			if max <= 0 {
+				return 0
+			}
+			return int(ms / max * 100)
+		},
+	}
+
+	tmpl, err := template.New("timetrace").Funcs(funcs).Parse(htmlTemplate)
+	if err != nil {
+		return fmt.Errorf("failed to parse report template: %w", err)
+	}
+
+	data := struct {
+		*TimeTraceReport
+		MaxTU       float64
+		MaxHeader   float64
+		MaxTemplate float64
+		MaxFunction float64
+	}{
+		TimeTraceReport: report,
+		MaxTU:           maxMs(report.TUs),
+		MaxHeader:       maxMs(report.Headers),
+		MaxTemplate:     maxMs(report.Templates),
+		MaxFunction:     maxMs(report.Functions),
+	}
+
+	file, err := os.Create(outputFile)
+	if err != nil {
+		return fmt.Errorf("failed to create report file: %w", err)
+	}
+	defer file.Close()
+
+	if err := tmpl.Execute(file, data); err != nil {
+		return fmt.Errorf("failed to render report: %w", err)
+	}
+	return nil
+}
+
+func maxMs(entries []TimeTraceEntry) float64 {
+	if len(entries) == 0 {
+		return 0
+	}
+	return entries[0].TotalMs
+}
@@ -0,0 +1,88 @@
+package build
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// durations are microseconds, as clang writes them
+const sampleTrace = `{
+  "traceEvents": [
+    {"name": "ExecuteCompiler", "dur": 2500000},
+    {"name": "Source", "dur": 800000, "args": {"detail": "/usr/include/vector"}},
+    {"name": "Source", "dur": 400000, "args": {"detail": "include/app/core.hpp"}},
+    {"name": "InstantiateClass", "dur": 600000, "args": {"detail": "std::vector<int>"}},
+    {"name": "InstantiateFunction", "dur": 200000, "args": {"detail": "std::sort<int *>"}},
+    {"name": "CodeGen Function", "dur": 300000, "args": {"detail": "main"}}
+  ]
+}`
+
+const secondTrace = `{
+  "traceEvents": [
+    {"name": "ExecuteCompiler", "dur": 1000000},
+    {"name": "Source", "dur": 500000, "args": {"detail": "/usr/include/vector"}},
+    {"name": "InstantiateClass", "dur": 100000, "args": {"detail": "std::vector<int>"}}
+  ]
+}`
+
+func TestCollectTimeTraces(t *testing.T) {
+	buildDir := t.TempDir()
+	require.NoError(t, os.WriteFile(filepath.Join(buildDir, "main.cpp.json"), []byte(sampleTrace), 0644))
+	require.NoError(t, os.WriteFile(filepath.Join(buildDir, "util.cpp.json"), []byte(secondTrace), 0644))
+	// Non-trace JSON (e.g. compile_commands.json) is skipped, not an error
+	require.NoError(t, os.WriteFile(filepath.Join(buildDir, "compile_commands.json"), []byte(`[{"file": "main.cpp"}]`), 0644))
+
+	report, err := CollectTimeTraces(buildDir)
+	require.NoError(t, err)
+
+	assert.InDelta(t, 3500.0, report.TotalMs, 0.01)
+
+	require.Len(t, report.TUs, 2)
+	assert.Equal(t, "main.cpp", report.TUs[0].Name)
+	assert.InDelta(t, 2500.0, report.TUs[0].TotalMs, 0.01)
+
+	// Header costs merge across TUs
+	require.NotEmpty(t, report.Headers)
+	assert.Equal(t, "/usr/include/vector", report.Headers[0].Name)
+	assert.InDelta(t, 1300.0, report.Headers[0].TotalMs, 0.01)
+	assert.Equal(t, 2, report.Headers[0].Count)
+
+	require.NotEmpty(t, report.Templates)
+	assert.Equal(t, "std::vector<int>", report.Templates[0].Name)
+
+	require.Len(t, report.Functions, 1)
+	assert.Equal(t, "main", report.Functions[0].Name)
+}
+
+func TestCollectTimeTraces_NoTraces(t *testing.T) {
+	buildDir := t.TempDir()
+	require.NoError(t, os.WriteFile(filepath.Join(buildDir, "compile_commands.json"), []byte(`[]`), 0644))
+
+	_, err := CollectTimeTraces(buildDir)
+	assert.Error(t, err)
+	assert.Contains(t, err.Error(), "requires clang")
+}
+
+func TestWriteTimeTraceReport(t *testing.T) {
+	buildDir := t.TempDir()
+	require.NoError(t, os.WriteFile(filepath.Join(buildDir, "main.cpp.json"), []byte(sampleTrace), 0644))
+
+	report, err := CollectTimeTraces(buildDir)
+	require.NoError(t, err)
+
+	outputFile := filepath.Join(t.TempDir(), "compile-time-report.html")
+	require.NoError(t, WriteTimeTraceReport(report, outputFile))
+
+	content, err := os.ReadFile(outputFile)
+	require.NoError(t, err)
+	html := string(content)
+
+	assert.Contains(t, html, "Compile-Time Report")
+	assert.Contains(t, html, "main.cpp")
+	assert.Contains(t, html, "/usr/include/vector")
+	assert.Contains(t, html, "std::vector&lt;int&gt;")
+}
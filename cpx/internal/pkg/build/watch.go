@@ -96,30 +96,26 @@ func DetectChanges(old, new FileSnapshot) []string {
 	return changed
 }
 
-// WatchAndBuild watches for file changes and triggers rebuilds
-func WatchAndBuild(release bool, jobs int, target string, optLevel string, verbose bool, sanitizer string, vcpkgClient *vcpkg.Client) error {
-	config := DefaultWatchConfig()
-
-	fmt.Printf("\033[36m👀 Watching for changes in: %s\033[0m\n", strings.Join(config.Directories, ", "))
-	fmt.Printf("\033[36m   Extensions: %s\033[0m\n", strings.Join(config.Extensions, ", "))
-	fmt.Printf("\033[33m   Press Ctrl+C to stop\033[0m\n\n")
-
-	// Initial build
-	fmt.Printf("\033[36m🔨 Initial build...\033[0m\n")
-	if err := BuildProject(release, jobs, target, false, optLevel, verbose, sanitizer, vcpkgClient); err != nil {
-		fmt.Printf("\033[31m✗ Build failed: %v\033[0m\n", err)
-	}
-
-	// Take initial snapshot
+// WatchChanges blocks, invoking onChange once per debounced burst of edits:
+// the callback only fires after the tree has been quiet for the configured
+// debounce interval, so a rapid save burst or an editor's rename dance
+// triggers a single rebuild instead of one per file event.
+func WatchChanges(config *WatchConfig, onChange func(changed []string)) error {
 	snapshot, err := TakeSnapshot(config)
 	if err != nil {
 		return fmt.Errorf("failed to take initial snapshot: %w", err)
 	}
 
-	// Watch loop
-	ticker := time.NewTicker(config.Debounce)
+	// Poll faster than the debounce so quiet periods are detected promptly
+	poll := config.Debounce / 2
+	if poll < 100*time.Millisecond {
+		poll = 100 * time.Millisecond
+	}
+	ticker := time.NewTicker(poll)
 	defer ticker.Stop()
 
+	var pending []string
+	var lastChange time.Time
 	for range ticker.C {
 		newSnapshot, err := TakeSnapshot(config)
 		if err != nil {
@@ -128,22 +124,66 @@ func WatchAndBuild(release bool, jobs int, target string, optLevel string, verbo
 		}
 
 		changes := DetectChanges(snapshot, newSnapshot)
+		snapshot = newSnapshot
 		if len(changes) > 0 {
-			fmt.Printf("\n\033[36m📝 Changes detected:\033[0m\n")
-			for _, change := range changes {
-				fmt.Printf("   %s\n", change)
-			}
-			fmt.Printf("\n\033[36m🔨 Rebuilding...\033[0m\n")
+			pending = append(pending, changes...)
+			lastChange = time.Now()
+			continue
+		}
 
-			if err := BuildProject(release, jobs, target, false, optLevel, verbose, sanitizer, vcpkgClient); err != nil {
-				fmt.Printf("\033[31m✗ Build failed: %v\033[0m\n", err)
-			} else {
-				fmt.Printf("\033[32m✓ Build succeeded\033[0m\n")
+		if len(pending) > 0 && time.Since(lastChange) >= config.Debounce {
+			onChange(dedupeChanged(pending))
+			pending = nil
+			// Re-snapshot after the callback so files the build itself
+			// touches do not immediately retrigger it
+			if post, err := TakeSnapshot(config); err == nil {
+				snapshot = post
 			}
-
-			snapshot = newSnapshot
 		}
 	}
 
 	return nil
 }
+
+// dedupeChanged collapses repeated edits of the same file within one burst,
+// preserving first-seen order
+func dedupeChanged(changed []string) []string {
+	seen := make(map[string]bool, len(changed))
+	var unique []string
+	for _, path := range changed {
+		if !seen[path] {
+			seen[path] = true
+			unique = append(unique, path)
+		}
+	}
+	return unique
+}
+
+// WatchAndBuild watches for file changes and triggers rebuilds
+func WatchAndBuild(release bool, jobs int, target string, optLevel string, verbose bool, sanitizer string, unity bool, lto string, pgo string, linker string, vcpkgClient *vcpkg.Client) error {
+	config := DefaultWatchConfig()
+
+	fmt.Printf("\033[36m👀 Watching for changes in: %s\033[0m\n", strings.Join(config.Directories, ", "))
+	fmt.Printf("\033[36m   Extensions: %s\033[0m\n", strings.Join(config.Extensions, ", "))
+	fmt.Printf("\033[33m   Press Ctrl+C to stop\033[0m\n\n")
+
+	// Initial build
+	fmt.Printf("\033[36m🔨 Initial build...\033[0m\n")
+	if err := BuildProject(release, jobs, target, false, optLevel, verbose, sanitizer, unity, lto, pgo, linker, false, false, false, vcpkgClient); err != nil {
+		fmt.Printf("\033[31m✗ Build failed: %v\033[0m\n", err)
+	}
+
+	return WatchChanges(config, func(changes []string) {
+		fmt.Printf("\n\033[36m📝 Changes detected:\033[0m\n")
+		for _, change := range changes {
+			fmt.Printf("   %s\n", change)
+		}
+		fmt.Printf("\n\033[36m🔨 Rebuilding...\033[0m\n")
+
+		if err := BuildProject(release, jobs, target, false, optLevel, verbose, sanitizer, unity, lto, pgo, linker, false, false, false, vcpkgClient); err != nil {
+			fmt.Printf("\033[31m✗ Build failed: %v\033[0m\n", err)
+		} else {
+			fmt.Printf("\033[32m✓ Build succeeded\033[0m\n")
+		}
+	})
+}
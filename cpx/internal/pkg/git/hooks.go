@@ -68,6 +68,56 @@ func InstallHooksWithConfig(preCommit []string, prePush []string) error {
 	return nil
 }
 
+// preCommitPrelude is shared scaffolding for the incremental checks: the
+// staged file list, changed-line range helpers, a content-hash verdict cache
+// and the worker count for the parallel fan-out
+const preCommitPrelude = `# Staged C/C++ files only; the checks below never touch the rest of the tree
+STAGED_FILES=$(git diff --cached --name-only --diff-filter=ACMR -- \
+    '*.c' '*.cc' '*.cpp' '*.cxx' '*.h' '*.hh' '*.hpp' '*.hxx')
+
+CACHE_DIR="$(git rev-parse --git-dir)/cpx-hook-cache"
+mkdir -p "$CACHE_DIR"
+
+JOBS=$(nproc 2>/dev/null || sysctl -n hw.ncpu 2>/dev/null || echo 4)
+
+# staged_lines <file>: changed-line ranges of the staged diff, emitted as
+# clang-format --lines arguments
+staged_lines() {
+    git diff --cached -U0 -- "$1" | awk '
+        /^@@/ { split($3, a, ","); start = substr(a[1], 2) + 0
+                count = (a[2] == "" ? 1 : a[2]) + 0
+                if (count > 0) printf "--lines=%d:%d ", start, start + count - 1 }'
+}
+
+# tidy_line_filter <file>: the same ranges as a clang-tidy --line-filter value
+tidy_line_filter() {
+    git diff --cached -U0 -- "$1" | awk -v f="$1" '
+        /^@@/ { split($3, a, ","); start = substr(a[1], 2) + 0
+                count = (a[2] == "" ? 1 : a[2]) + 0
+                if (count > 0) { if (n++) r = r ","
+                                 r = r "[" start "," start + count - 1 "]" } }
+        END { if (n) printf "[{\"name\":\"%s\",\"lines\":[%s]}]", f, r }'
+}
+
+# verdict_cached <check> <file>: succeeds if this exact staged content already
+# passed <check>; keyed by the staged blob hash so repeat commits are instant
+verdict_cached() {
+    local hash
+    hash=$(git ls-files -s -- "$2" | awk '{print $2}')
+    [ -n "$hash" ] && [ -f "$CACHE_DIR/$1-$hash" ]
+}
+
+record_verdict() {
+    local hash
+    hash=$(git ls-files -s -- "$2" | awk '{print $2}')
+    [ -n "$hash" ] && touch "$CACHE_DIR/$1-$hash"
+}
+
+export CACHE_DIR
+export -f staged_lines tidy_line_filter verdict_cached record_verdict
+
+`
+
 // InstallPreCommitHook installs the pre-commit hook with specified checks
 func InstallPreCommitHook(hooksDir string, checks []string) error {
 	hookPath := filepath.Join(hooksDir, "pre-commit")
@@ -83,31 +133,69 @@ func InstallPreCommitHook(hooksDir string, checks []string) error {
 	sb.WriteString("# Generated by cpx\n\n")
 	sb.WriteString("echo \" Running pre-commit checks...\"\n\n")
 
+	// The fmt and lint checks are incremental; emit their shared helpers once
+	for _, check := range checks {
+		check = strings.TrimSpace(strings.ToLower(check))
+		if check == "fmt" || check == "lint" {
+			sb.WriteString(preCommitPrelude)
+			break
+		}
+	}
+
 	// Generate commands based on checks
 	for _, check := range checks {
 		check = strings.TrimSpace(strings.ToLower(check))
 		switch check {
 		case "fmt":
-			sb.WriteString(`# Format code
-if command -v cpx &> /dev/null; then
-    echo " Formatting code..."
-    if ! cpx fmt; then
-        echo "  cpx fmt failed, continuing..."
+			sb.WriteString(`# Check formatting of the staged changes only
+check_fmt() {
+    verdict_cached fmt "$1" && return 0
+    local lines
+    lines=$(staged_lines "$1")
+    [ -z "$lines" ] && return 0
+    if ! clang-format --dry-run -Werror $lines "$1" >/dev/null 2>&1; then
+        echo "  needs formatting: $1"
+        return 1
     fi
-else
-    echo "  cpx not found, skipping formatting"
+    record_verdict fmt "$1"
+}
+export -f check_fmt
+
+if [ -n "$STAGED_FILES" ] && command -v clang-format &> /dev/null; then
+    echo " Checking format of staged files..."
+    if ! printf '%s\n' "$STAGED_FILES" | xargs -P "$JOBS" -n 1 bash -c 'check_fmt "$0"'; then
+        echo "  staged changes need formatting; run 'cpx fmt' and restage (non-blocking)"
+    fi
+elif [ -n "$STAGED_FILES" ]; then
+    echo "  clang-format not found, skipping format check"
 fi
 
 `)
 		case "lint":
-			sb.WriteString(`# Run linter
-if command -v cpx &> /dev/null; then
-    echo " Running linter..."
-    if ! cpx lint; then
-        echo "  cpx lint found issues (non-blocking)"
+			sb.WriteString(`# Lint only the changed lines of staged files
+check_lint() {
+    verdict_cached lint "$1" && return 0
+    local filter
+    filter=$(tidy_line_filter "$1")
+    [ -z "$filter" ] && return 0
+    local db_args=()
+    if [ -f .cache/native/debug/compile_commands.json ]; then
+        db_args=(-p .cache/native/debug)
     fi
-else
-    echo "  cpx not found, skipping linting"
+    if ! clang-tidy --quiet --line-filter="$filter" "${db_args[@]}" "$1" 2>/dev/null; then
+        return 1
+    fi
+    record_verdict lint "$1"
+}
+export -f check_lint
+
+if [ -n "$STAGED_FILES" ] && command -v clang-tidy &> /dev/null; then
+    echo " Linting staged files..."
+    if ! printf '%s\n' "$STAGED_FILES" | xargs -P "$JOBS" -n 1 bash -c 'check_lint "$0"'; then
+        echo "  clang-tidy found issues (non-blocking)"
+    fi
+elif [ -n "$STAGED_FILES" ]; then
+    echo "  clang-tidy not found, skipping lint"
 fi
 
 `)
@@ -7,7 +7,9 @@ import (
 	"os"
 	"os/exec"
 	"path/filepath"
+	"runtime"
 	"strings"
+	"sync"
 	"time"
 )
 
@@ -45,7 +47,7 @@ type ComprehensiveAnalysis struct {
 }
 
 // RunComprehensiveAnalysis runs all analysis tools and generates an HTML report
-func RunComprehensiveAnalysis(outputFile string, skipCppcheck, skipLint, skipFlawfinder bool, targets []string, vcpkg VcpkgSetup) error {
+func RunComprehensiveAnalysis(outputFile string, skipCppcheck, skipLint, skipFlawfinder, includes bool, targets []string, vcpkg VcpkgSetup) error {
 	fmt.Printf("%sRunning comprehensive code analysis...%s\n", Cyan, Reset)
 
 	analysis := ComprehensiveAnalysis{
@@ -55,28 +57,59 @@ func RunComprehensiveAnalysis(outputFile string, skipCppcheck, skipLint, skipFla
 	analysis.Summary.BySeverity = make(map[string]int)
 	analysis.Summary.ByTool = make(map[string]int)
 
-	// Run Cppcheck
+	// The three tools are independent, so run them concurrently and merge
+	// their results in a fixed order afterwards to keep reports deterministic
+	var wg sync.WaitGroup
+	var cppcheckResults, lintResults, flawfinderResults, includeResults *ToolResults
+
 	if !skipCppcheck {
 		fmt.Printf("%sRunning Cppcheck...%s\n", Cyan, Reset)
-		cppcheckResults := runCppcheckAnalysis(targets)
-		analysis.Tools = append(analysis.Tools, cppcheckResults)
-		updateSummary(&analysis, cppcheckResults)
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			r := runCppcheckAnalysis(targets)
+			cppcheckResults = &r
+		}()
 	}
 
-	// Run clang-tidy
 	if !skipLint {
 		fmt.Printf("%sRunning clang-tidy...%s\n", Cyan, Reset)
-		lintResults := runLintAnalysis(vcpkg)
-		analysis.Tools = append(analysis.Tools, lintResults)
-		updateSummary(&analysis, lintResults)
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			r := runLintAnalysis(vcpkg)
+			lintResults = &r
+		}()
 	}
 
-	// Run Flawfinder
 	if !skipFlawfinder {
 		fmt.Printf("%sRunning Flawfinder...%s\n", Cyan, Reset)
-		flawfinderResults := runFlawfinderAnalysis(targets)
-		analysis.Tools = append(analysis.Tools, flawfinderResults)
-		updateSummary(&analysis, flawfinderResults)
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			r := runFlawfinderAnalysis(targets)
+			flawfinderResults = &r
+		}()
+	}
+
+	if includes {
+		fmt.Printf("%sAnalyzing include graph...%s\n", Cyan, Reset)
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			r := runIncludeAnalysis()
+			includeResults = &r
+		}()
+	}
+
+	wg.Wait()
+
+	for _, toolResults := range []*ToolResults{cppcheckResults, lintResults, flawfinderResults, includeResults} {
+		if toolResults == nil {
+			continue
+		}
+		analysis.Tools = append(analysis.Tools, *toolResults)
+		updateSummary(&analysis, *toolResults)
 	}
 
 	// Generate HTML report
@@ -217,6 +250,16 @@ func runCppcheckAnalysis(targets []string) ToolResults {
 		fmt.Printf("Debug: cppcheck sourceDirs: %v\n", sourceDirs)
 	}
 
+	// cppcheck scans whole directories, so the incremental cache keys on the
+	// hash of the entire source tree: an unchanged tree skips the run
+	cache := LoadAnalysisCache("cppcheck")
+	cacheFlags := []string{"--enable=all"}
+	treeHash := HashSourceDirs(sourceDirs, cacheFlags)
+	if cached, ok := cache.Lookup("tree", treeHash); ok {
+		result.Results = cached
+		return result
+	}
+
 	// Create temporary XML file
 	tmpXML, err := os.CreateTemp("", "cppcheck-*.xml")
 	if err != nil {
@@ -230,7 +273,8 @@ func runCppcheckAnalysis(targets []string) ToolResults {
 	// Run cppcheck with XML output directly to file
 	// Using --xml with --output-file writes XML directly to the file
 	// Pass directories to scan (cppcheck will scan all non-ignored files in those directories)
-	args := []string{"--enable=all", "--xml", "--xml-version=2", "--output-file=" + tmpXML.Name()}
+	// -j shards the check across cores; cppcheck serializes results into the output file itself
+	args := []string{"--enable=all", fmt.Sprintf("-j%d", runtime.NumCPU()), "--xml", "--xml-version=2", "--output-file=" + tmpXML.Name()}
 	args = append(args, sourceDirs...)
 
 	// Run cppcheck - XML will be written directly to the file
@@ -274,6 +318,9 @@ func runCppcheckAnalysis(targets []string) ToolResults {
 	results := parseCppcheckXML(tmpXML.Name())
 	result.Results = results
 
+	cache.Store("tree", treeHash, results)
+	cache.Save()
+
 	return result
 }
 
@@ -527,14 +574,69 @@ func runLintAnalysis(vcpkg VcpkgSetup) ToolResults {
 	for _, include := range systemIncludes {
 		tidyArgs = append(tidyArgs, "--extra-arg=-isystem"+include)
 	}
-	tidyArgs = append(tidyArgs, files...)
 
-	cmd := exec.Command("clang-tidy", tidyArgs...)
-	output, _ := cmd.CombinedOutput()
+	// Incremental cache: skip files whose content and flags are unchanged
+	// since the last run and reuse their prior findings
+	cache := LoadAnalysisCache("clang-tidy")
+	fileResults := make([][]AnalysisResult, len(files))
+	hashes := make([]string, len(files))
+	var pending []int
+	for i, file := range files {
+		hash, err := HashFileWithFlags(file, tidyArgs)
+		if err != nil {
+			pending = append(pending, i)
+			continue
+		}
+		hashes[i] = hash
+		if cached, ok := cache.Lookup(file, hash); ok {
+			fileResults[i] = cached
+			continue
+		}
+		pending = append(pending, i)
+	}
+
+	// clang-tidy is single-process and dominates analysis time on large
+	// compile databases, so shard the remaining files across a core-sized
+	// worker pool and merge outputs in file order to keep results deterministic
+	workers := runtime.NumCPU()
+	if workers > len(pending) {
+		workers = len(pending)
+	}
 
-	// Parse clang-tidy output
-	results := parseClangTidyOutput(string(output))
-	result.Results = results
+	outputs := make([]string, len(files))
+	jobs := make(chan int)
+	var wg sync.WaitGroup
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for i := range jobs {
+				args := append(append([]string{}, tidyArgs...), files[i])
+				cmd := exec.Command("clang-tidy", args...)
+				output, _ := cmd.CombinedOutput()
+				outputs[i] = string(output)
+			}
+		}()
+	}
+	for _, i := range pending {
+		jobs <- i
+	}
+	close(jobs)
+	wg.Wait()
+
+	// Parse clang-tidy output per shard and record it for the next run
+	for _, i := range pending {
+		parsed := parseClangTidyOutput(outputs[i])
+		fileResults[i] = parsed
+		if hashes[i] != "" {
+			cache.Store(files[i], hashes[i], parsed)
+		}
+	}
+	cache.Save()
+
+	for _, results := range fileResults {
+		result.Results = append(result.Results, results...)
+	}
 
 	return result
 }
@@ -655,6 +757,15 @@ func runFlawfinderAnalysis(targets []string) ToolResults {
 		return result
 	}
 
+	// Same directory-level incremental cache as cppcheck
+	cache := LoadAnalysisCache("flawfinder")
+	cacheFlags := []string{"--csv", "-m", "1"}
+	treeHash := HashSourceDirs(sourceDirs, cacheFlags)
+	if cached, ok := cache.Lookup("tree", treeHash); ok {
+		result.Results = cached
+		return result
+	}
+
 	// Run flawfinder with CSV output
 	// Pass directories to scan (flawfinder will scan all non-ignored files in those directories)
 	args := []string{"--csv", "-m", "1"}
@@ -688,6 +799,9 @@ func runFlawfinderAnalysis(targets []string) ToolResults {
 		fmt.Printf("Debug: flawfinder parsed results: %d\n", len(results))
 	}
 
+	cache.Store("tree", treeHash, results)
+	cache.Save()
+
 	return result
 }
 
@@ -0,0 +1,134 @@
+package quality
+
+import (
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"sync"
+)
+
+// AnalysisCache is a per-tool cache of prior findings keyed by file (or
+// directory set) and invalidated by a content+flags hash. It lets repeated
+// cpx analyze runs skip files that have not changed since the last run.
+type AnalysisCache struct {
+	mu      sync.Mutex
+	path    string
+	Entries map[string]AnalysisCacheEntry `json:"entries"`
+}
+
+// AnalysisCacheEntry stores the findings recorded for a key along with the
+// hash they were produced from.
+type AnalysisCacheEntry struct {
+	Hash    string           `json:"hash"`
+	Results []AnalysisResult `json:"results"`
+}
+
+// LoadAnalysisCache loads the cache for a tool from .cache/analysis/<tool>.json.
+// A missing or unreadable cache is not an error; it just starts empty.
+func LoadAnalysisCache(tool string) *AnalysisCache {
+	cache := &AnalysisCache{
+		path:    filepath.Join(".cache", "analysis", tool+".json"),
+		Entries: make(map[string]AnalysisCacheEntry),
+	}
+
+	data, err := os.ReadFile(cache.path)
+	if err != nil {
+		return cache
+	}
+	if err := json.Unmarshal(data, &cache.Entries); err != nil {
+		// Corrupt cache: drop it and re-analyze everything
+		cache.Entries = make(map[string]AnalysisCacheEntry)
+	}
+	return cache
+}
+
+// Lookup returns the cached results for key if they were produced from the
+// same hash.
+func (c *AnalysisCache) Lookup(key, hash string) ([]AnalysisResult, bool) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	entry, ok := c.Entries[key]
+	if !ok || entry.Hash != hash {
+		return nil, false
+	}
+	return entry.Results, true
+}
+
+// Store records the results for key under the given hash.
+func (c *AnalysisCache) Store(key, hash string, results []AnalysisResult) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	c.Entries[key] = AnalysisCacheEntry{Hash: hash, Results: results}
+}
+
+// Save writes the cache back to disk.
+func (c *AnalysisCache) Save() error {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	if err := os.MkdirAll(filepath.Dir(c.path), 0755); err != nil {
+		return fmt.Errorf("failed to create analysis cache dir: %w", err)
+	}
+	data, err := json.Marshal(c.Entries)
+	if err != nil {
+		return fmt.Errorf("failed to encode analysis cache: %w", err)
+	}
+	if err := os.WriteFile(c.path, data, 0644); err != nil {
+		return fmt.Errorf("failed to write analysis cache: %w", err)
+	}
+	return nil
+}
+
+// HashFileWithFlags hashes a file's content together with the analysis flags
+// that apply to it, so either a source edit or a flag change invalidates the
+// cached findings.
+func HashFileWithFlags(path string, flags []string) (string, error) {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return "", err
+	}
+
+	h := sha256.New()
+	h.Write(data)
+	h.Write([]byte(strings.Join(flags, "\x00")))
+	return hex.EncodeToString(h.Sum(nil)), nil
+}
+
+// HashSourceDirs hashes the content of all C/C++ files under the given
+// directories plus the tool flags. Used for tools that scan whole directories
+// rather than individual files, so an unchanged tree skips the run entirely.
+func HashSourceDirs(dirs []string, flags []string) string {
+	var files []string
+	for _, dir := range dirs {
+		filepath.Walk(dir, func(path string, info os.FileInfo, err error) error {
+			if err != nil || info.IsDir() {
+				return nil
+			}
+			switch filepath.Ext(path) {
+			case ".c", ".cc", ".cpp", ".cxx", ".c++", ".h", ".hh", ".hpp", ".hxx":
+				files = append(files, path)
+			}
+			return nil
+		})
+	}
+	sort.Strings(files)
+
+	h := sha256.New()
+	for _, file := range files {
+		data, err := os.ReadFile(file)
+		if err != nil {
+			continue
+		}
+		h.Write([]byte(file))
+		h.Write(data)
+	}
+	h.Write([]byte(strings.Join(flags, "\x00")))
+	return hex.EncodeToString(h.Sum(nil))
+}
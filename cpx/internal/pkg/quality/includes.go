@@ -0,0 +1,406 @@
+package quality
+
+import (
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"regexp"
+	"sort"
+	"strings"
+
+	"github.com/ozacod/cpx/internal/pkg/build"
+)
+
+// compileDBEntry mirrors the fields of compile_commands.json the include
+// analysis needs
+type compileDBEntry struct {
+	Directory string   `json:"directory"`
+	Command   string   `json:"command"`
+	Arguments []string `json:"arguments"`
+	File      string   `json:"file"`
+}
+
+// includeRef is one #include directive found in a file
+type includeRef struct {
+	name     string // as written between the quotes/brackets
+	resolved string // absolute path, empty when outside the project
+	line     int
+	quoted   bool
+}
+
+// headerStat aggregates the cost of one project header across all TUs
+type headerStat struct {
+	path       string
+	tuCount    int     // TUs that reach it, directly or transitively
+	transBytes int64   // own size plus everything it pulls in
+	traceMs    float64 // compile time attributed by -ftime-trace, if available
+}
+
+// Cap the expensive-header findings; beyond this the tail is noise
+const includeTopN = 15
+
+var includeDirectiveRe = regexp.MustCompile(`(?m)^\s*#\s*include\s*(["<])([^">]+)[">]`)
+
+// includeGraph memoizes the per-file include parse and transitive closure so
+// headers shared by many TUs are only read once
+type includeGraph struct {
+	projectRoot string
+	includeDirs []string
+	directMemo  map[string][]includeRef
+	reachMemo   map[string]map[string]bool
+	sizeMemo    map[string]int64
+}
+
+// runIncludeAnalysis builds the header dependency graph from the compile
+// database, attributes preprocessed size (and time-trace cost when a traced
+// build exists) to each header, and reports the most expensive includes plus
+// redundant-include suggestions.
+func runIncludeAnalysis() ToolResults {
+	result := ToolResults{
+		Tool:    "Include Analysis",
+		Status:  "success",
+		Results: []AnalysisResult{},
+	}
+
+	dbPath := findCompileDB()
+	if dbPath == "" {
+		result.Status = "skipped"
+		result.Error = "compile_commands.json not found. Run 'cpx build' first."
+		return result
+	}
+
+	entries, err := loadCompileDB(dbPath)
+	if err != nil {
+		result.Status = "error"
+		result.Error = fmt.Sprintf("failed to read %s: %v", dbPath, err)
+		return result
+	}
+	if len(entries) == 0 {
+		result.Status = "skipped"
+		result.Error = "compile database is empty"
+		return result
+	}
+
+	projectRoot, _ := os.Getwd()
+	graph := &includeGraph{
+		projectRoot: projectRoot,
+		directMemo:  make(map[string][]includeRef),
+		reachMemo:   make(map[string]map[string]bool),
+		sizeMemo:    make(map[string]int64),
+	}
+
+	stats := make(map[string]*headerStat)
+	for _, entry := range entries {
+		tuPath := entry.File
+		if !filepath.IsAbs(tuPath) {
+			tuPath = filepath.Join(entry.Directory, tuPath)
+		}
+		graph.includeDirs = includeDirsFromEntry(entry)
+
+		// Attribute this TU once to every header it reaches
+		for header := range graph.reach(tuPath) {
+			stat, ok := stats[header]
+			if !ok {
+				stat = &headerStat{path: header, transBytes: graph.transitiveBytes(header)}
+				stats[header] = stat
+			}
+			stat.tuCount++
+		}
+
+		// A direct include already reached through an earlier direct include
+		// is redundant; dropping it cheapens future refactors of that header
+		result.Results = append(result.Results, redundantIncludes(graph, tuPath)...)
+	}
+
+	// Fold in per-header compile time from the last traced build, if any
+	attachTraceCosts(filepath.Dir(dbPath), stats)
+
+	result.Results = append(result.Results, expensiveHeaders(stats, len(entries))...)
+	return result
+}
+
+// findCompileDB locates the compile database, preferring the legacy build/
+// directory and falling back to the per-variant trees under .cache/native
+func findCompileDB() string {
+	candidates := []string{
+		filepath.Join("build", "compile_commands.json"),
+		filepath.Join(".cache", "native", "debug", "compile_commands.json"),
+	}
+	dirs, _ := os.ReadDir(filepath.Join(".cache", "native"))
+	for _, dir := range dirs {
+		if dir.IsDir() && dir.Name() != "vcpkg_installed" {
+			candidates = append(candidates, filepath.Join(".cache", "native", dir.Name(), "compile_commands.json"))
+		}
+	}
+	for _, candidate := range candidates {
+		if _, err := os.Stat(candidate); err == nil {
+			abs, err := filepath.Abs(candidate)
+			if err == nil {
+				return abs
+			}
+		}
+	}
+	return ""
+}
+
+func loadCompileDB(path string) ([]compileDBEntry, error) {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return nil, err
+	}
+	var entries []compileDBEntry
+	if err := json.Unmarshal(data, &entries); err != nil {
+		return nil, err
+	}
+	return entries, nil
+}
+
+// includeDirsFromEntry extracts the -I/-iquote/-isystem search paths of one
+// compile command, resolved against its working directory
+func includeDirsFromEntry(entry compileDBEntry) []string {
+	args := entry.Arguments
+	if len(args) == 0 {
+		args = strings.Fields(entry.Command)
+	}
+
+	var dirs []string
+	addDir := func(dir string) {
+		if dir == "" {
+			return
+		}
+		if !filepath.IsAbs(dir) {
+			dir = filepath.Join(entry.Directory, dir)
+		}
+		dirs = append(dirs, filepath.Clean(dir))
+	}
+
+	for i := 0; i < len(args); i++ {
+		arg := args[i]
+		switch {
+		case arg == "-I" || arg == "-iquote" || arg == "-isystem":
+			if i+1 < len(args) {
+				addDir(args[i+1])
+				i++
+			}
+		case strings.HasPrefix(arg, "-I"):
+			addDir(arg[2:])
+		case strings.HasPrefix(arg, "-iquote"):
+			addDir(arg[7:])
+		case strings.HasPrefix(arg, "-isystem"):
+			addDir(arg[8:])
+		}
+	}
+	return dirs
+}
+
+// direct parses a file's #include directives, resolving each against the
+// file's own directory (quoted form) and the include search paths. Includes
+// that resolve outside the project are kept for reporting but not descended
+// into; the graph only scales with the project's own headers.
+func (g *includeGraph) direct(path string) []includeRef {
+	if refs, ok := g.directMemo[path]; ok {
+		return refs
+	}
+
+	var refs []includeRef
+	data, err := os.ReadFile(path)
+	if err != nil {
+		g.directMemo[path] = refs
+		return refs
+	}
+
+	for _, match := range includeDirectiveRe.FindAllSubmatchIndex(data, -1) {
+		quoted := data[match[2]] == '"'
+		name := string(data[match[4]:match[5]])
+		line := 1 + strings.Count(string(data[:match[0]]), "\n")
+		refs = append(refs, includeRef{
+			name:     name,
+			resolved: g.resolve(path, name, quoted),
+			line:     line,
+			quoted:   quoted,
+		})
+	}
+	g.directMemo[path] = refs
+	return refs
+}
+
+// resolve maps an include name to a project-local absolute path, or "" when
+// it is a system or third-party header
+func (g *includeGraph) resolve(from string, name string, quoted bool) string {
+	var candidates []string
+	if quoted {
+		candidates = append(candidates, filepath.Join(filepath.Dir(from), name))
+	}
+	for _, dir := range g.includeDirs {
+		candidates = append(candidates, filepath.Join(dir, name))
+	}
+
+	for _, candidate := range candidates {
+		if info, err := os.Stat(candidate); err == nil && !info.IsDir() {
+			abs, err := filepath.Abs(candidate)
+			if err != nil {
+				continue
+			}
+			if strings.HasPrefix(abs, g.projectRoot+string(filepath.Separator)) &&
+				!strings.Contains(abs, string(filepath.Separator)+"vcpkg_installed"+string(filepath.Separator)) {
+				return abs
+			}
+		}
+	}
+	return ""
+}
+
+// reach returns every project header reachable from path, excluding path
+// itself. Cycles (include guards) are handled by seeding the memo before
+// descending.
+func (g *includeGraph) reach(path string) map[string]bool {
+	if reached, ok := g.reachMemo[path]; ok {
+		return reached
+	}
+
+	reached := make(map[string]bool)
+	g.reachMemo[path] = reached
+	for _, ref := range g.direct(path) {
+		if ref.resolved == "" || reached[ref.resolved] {
+			continue
+		}
+		reached[ref.resolved] = true
+		for sub := range g.reach(ref.resolved) {
+			reached[sub] = true
+		}
+	}
+	return reached
+}
+
+// transitiveBytes approximates a header's preprocessed footprint: its own
+// size plus the size of every project header it pulls in
+func (g *includeGraph) transitiveBytes(path string) int64 {
+	total := g.size(path)
+	for sub := range g.reach(path) {
+		total += g.size(sub)
+	}
+	return total
+}
+
+func (g *includeGraph) size(path string) int64 {
+	if size, ok := g.sizeMemo[path]; ok {
+		return size
+	}
+	var size int64
+	if info, err := os.Stat(path); err == nil {
+		size = info.Size()
+	}
+	g.sizeMemo[path] = size
+	return size
+}
+
+// redundantIncludes flags direct includes of a TU that are already pulled in
+// transitively by another of its direct includes
+func redundantIncludes(g *includeGraph, tuPath string) []AnalysisResult {
+	var findings []AnalysisResult
+	direct := g.direct(tuPath)
+	for _, ref := range direct {
+		if ref.resolved == "" {
+			continue
+		}
+		for _, other := range direct {
+			if other.resolved == "" || other.resolved == ref.resolved {
+				continue
+			}
+			if g.reach(other.resolved)[ref.resolved] {
+				findings = append(findings, AnalysisResult{
+					Tool:     "Include Analysis",
+					Severity: "info",
+					File:     relToCwd(tuPath),
+					Line:     ref.line,
+					Message:  fmt.Sprintf("\"%s\" is already included transitively via \"%s\"; it can likely be dropped", ref.name, other.name),
+					Rule:     "redundant-include",
+				})
+				break
+			}
+		}
+	}
+	return findings
+}
+
+// expensiveHeaders ranks headers by total preprocessed footprint across the
+// build (transitive size x number of including TUs) and reports the top of
+// the list
+func expensiveHeaders(stats map[string]*headerStat, totalTUs int) []AnalysisResult {
+	ranked := make([]*headerStat, 0, len(stats))
+	for _, stat := range stats {
+		ranked = append(ranked, stat)
+	}
+	sort.Slice(ranked, func(i, j int) bool {
+		return ranked[i].transBytes*int64(ranked[i].tuCount) > ranked[j].transBytes*int64(ranked[j].tuCount)
+	})
+	if len(ranked) > includeTopN {
+		ranked = ranked[:includeTopN]
+	}
+
+	var findings []AnalysisResult
+	for _, stat := range ranked {
+		totalBytes := stat.transBytes * int64(stat.tuCount)
+		// A header recompiled into most TUs is the one worth breaking up;
+		// one-off heavy headers are only worth an info note
+		severity := "info"
+		if totalTUs > 1 && stat.tuCount*2 >= totalTUs {
+			severity = "warning"
+		}
+		msg := fmt.Sprintf("included by %d of %d TUs, ~%s pulled in each time (~%s per full build); consider forward declarations or splitting it",
+			stat.tuCount, totalTUs, formatBytes(stat.transBytes), formatBytes(totalBytes))
+		if stat.traceMs > 0 {
+			msg += fmt.Sprintf("; %.0fms compile time in the last traced build", stat.traceMs)
+		}
+		findings = append(findings, AnalysisResult{
+			Tool:     "Include Analysis",
+			Severity: severity,
+			File:     relToCwd(stat.path),
+			Line:     1,
+			Message:  msg,
+			Rule:     "expensive-include",
+		})
+	}
+	return findings
+}
+
+// attachTraceCosts folds per-header compile time from -ftime-trace output in
+// the build directory into the header stats. Traces are optional; builds
+// without --time-trace just skip this.
+func attachTraceCosts(buildDir string, stats map[string]*headerStat) {
+	report, err := build.CollectTimeTraces(buildDir)
+	if err != nil {
+		return
+	}
+	for _, entry := range report.Headers {
+		abs, err := filepath.Abs(entry.Name)
+		if err != nil {
+			continue
+		}
+		if stat, ok := stats[abs]; ok {
+			stat.traceMs = entry.TotalMs
+		}
+	}
+}
+
+func relToCwd(path string) string {
+	cwd, err := os.Getwd()
+	if err != nil {
+		return path
+	}
+	if rel, err := filepath.Rel(cwd, path); err == nil && !strings.HasPrefix(rel, "..") {
+		return rel
+	}
+	return path
+}
+
+func formatBytes(bytes int64) string {
+	switch {
+	case bytes >= 1<<20:
+		return fmt.Sprintf("%.1f MB", float64(bytes)/(1<<20))
+	case bytes >= 1<<10:
+		return fmt.Sprintf("%.1f KB", float64(bytes)/(1<<10))
+	}
+	return fmt.Sprintf("%d B", bytes)
+}
@@ -107,17 +107,511 @@ std::string version() {
 	return sb.String()
 }
 
-func GenerateTestMain(projectName string, testingFramework string) string {
+// GenerateCoreHeader generates include/<project>/core.hpp, a header-only
+// performance foundation scaffolded when the user opts into the
+// high-performance core: a monotonic arena allocator, a small-buffer vector
+// and a fixed-capacity ring buffer. These are the three structures every
+// latency-sensitive service ends up hand-rolling; scaffolding vetted ones
+// sets the allocation discipline from day one.
+func GenerateCoreHeader(projectName string) string {
+	safeName := naming.SafeIdent(projectName)
+	guard := naming.SafeIdentUpper(projectName) + "_CORE_HPP"
+	return fmt.Sprintf(`#ifndef %[1]s
+#define %[1]s
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace %[2]s::core {
+
+/**
+ * @brief Monotonic arena allocator.
+ *
+ * Bump-allocates out of large blocks; individual allocations are never
+ * freed, the whole arena is rewound with reset(). Use one arena per
+ * frame/request and reset it at the end: allocation becomes a pointer
+ * increment and deallocation becomes free.
+ */
+class arena {
+public:
+    explicit arena(std::size_t block_size = 64 * 1024) : block_size_(block_size) {}
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+    ~arena() { free_blocks(head_); }
+
+    /// Bump-allocates size bytes aligned to align. O(1), no per-object free.
+    void* allocate(std::size_t size, std::size_t align = alignof(std::max_align_t)) {
+        std::uintptr_t aligned = align_up(cursor_, align);
+        if (head_ == nullptr || aligned + size > end_) {
+            grow(size + align);
+            aligned = align_up(cursor_, align);
+        }
+        cursor_ = aligned + size;
+        used_ += size;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    /// Constructs a T in the arena. The arena never runs destructors.
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(std::is_trivially_destructible<T>::value,
+                      "arena never runs destructors; use trivially destructible types");
+        return ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /// Rewinds to the first block and drops the rest. Capacity is retained,
+    /// so steady-state frames allocate without touching the system allocator.
+    void reset() {
+        if (head_ == nullptr) return;
+        free_blocks(head_->next);
+        head_->next = nullptr;
+        tail_ = head_;
+        cursor_ = head_->data();
+        end_ = head_->data() + head_->size;
+        used_ = 0;
+    }
+
+    std::size_t bytes_used() const { return used_; }
+
+private:
+    struct block {
+        block* next;
+        std::size_t size;
+        std::uintptr_t data() const {
+            return reinterpret_cast<std::uintptr_t>(this) + sizeof(block);
+        }
+    };
+
+    static std::uintptr_t align_up(std::uintptr_t p, std::size_t align) {
+        return (p + align - 1) & ~(static_cast<std::uintptr_t>(align) - 1);
+    }
+
+    void grow(std::size_t min_size) {
+        std::size_t size = min_size > block_size_ ? min_size : block_size_;
+        block* b = static_cast<block*>(::operator new(sizeof(block) + size));
+        b->next = nullptr;
+        b->size = size;
+        if (head_ == nullptr) {
+            head_ = b;
+        } else {
+            tail_->next = b;
+        }
+        tail_ = b;
+        cursor_ = b->data();
+        end_ = b->data() + size;
+    }
+
+    static void free_blocks(block* b) {
+        while (b != nullptr) {
+            block* next = b->next;
+            ::operator delete(b);
+            b = next;
+        }
+    }
+
+    block* head_ = nullptr;
+    block* tail_ = nullptr;
+    std::size_t block_size_;
+    std::uintptr_t cursor_ = 0;
+    std::uintptr_t end_ = 0;
+    std::size_t used_ = 0;
+};
+
+/**
+ * @brief Vector with inline storage for the first N elements.
+ *
+ * Small collections (the common case on hot paths) never touch the heap;
+ * larger ones spill to a heap buffer like std::vector. Keep N sized to the
+ * p99 of the collection, not the maximum.
+ */
+template <typename T, std::size_t N>
+class small_vector {
+    static_assert(N > 0, "small_vector needs at least one inline slot");
+
+public:
+    small_vector() = default;
+
+    small_vector(const small_vector& other) {
+        reserve(other.size_);
+        for (std::size_t i = 0; i < other.size_; ++i) {
+            ::new (data_ + i) T(other.data_[i]);
+        }
+        size_ = other.size_;
+    }
+
+    small_vector(small_vector&& other) noexcept {
+        steal_or_move(other);
+    }
+
+    small_vector& operator=(const small_vector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size_);
+            for (std::size_t i = 0; i < other.size_; ++i) {
+                ::new (data_ + i) T(other.data_[i]);
+            }
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& other) noexcept {
+        if (this != &other) {
+            clear();
+            release_heap();
+            steal_or_move(other);
+        }
+        return *this;
+    }
+
+    ~small_vector() {
+        clear();
+        release_heap();
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            grow(capacity_ * 2);
+        }
+        T* slot = ::new (data_ + size_) T(std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    void reserve(std::size_t new_cap) {
+        if (new_cap > capacity_) {
+            grow(new_cap);
+        }
+    }
+
+    void clear() {
+        for (std::size_t i = 0; i < size_; ++i) {
+            data_[i].~T();
+        }
+        size_ = 0;
+    }
+
+    T& operator[](std::size_t i) { return data_[i]; }
+    const T& operator[](std::size_t i) const { return data_[i]; }
+
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+    T* begin() { return data_; }
+    T* end() { return data_ + size_; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+
+    std::size_t size() const { return size_; }
+    std::size_t capacity() const { return capacity_; }
+    bool empty() const { return size_ == 0; }
+    bool on_heap() const { return data_ != inline_data(); }
+
+private:
+    T* inline_data() { return reinterpret_cast<T*>(inline_); }
+    const T* inline_data() const { return reinterpret_cast<const T*>(inline_); }
+
+    void grow(std::size_t new_cap) {
+        T* heap = static_cast<T*>(::operator new(new_cap * sizeof(T)));
+        for (std::size_t i = 0; i < size_; ++i) {
+            ::new (heap + i) T(std::move(data_[i]));
+            data_[i].~T();
+        }
+        release_heap();
+        data_ = heap;
+        capacity_ = new_cap;
+    }
+
+    void release_heap() {
+        if (on_heap()) {
+            ::operator delete(data_);
+        }
+        data_ = inline_data();
+        capacity_ = N;
+    }
+
+    void steal_or_move(small_vector& other) {
+        if (other.on_heap()) {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            size_ = other.size_;
+            other.data_ = other.inline_data();
+            other.capacity_ = N;
+            other.size_ = 0;
+        } else {
+            for (std::size_t i = 0; i < other.size_; ++i) {
+                ::new (data_ + i) T(std::move(other.data_[i]));
+            }
+            size_ = other.size_;
+            other.clear();
+        }
+    }
+
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+    T* data_ = inline_data();
+    std::size_t size_ = 0;
+    std::size_t capacity_ = N;
+};
+
+/**
+ * @brief Fixed-capacity FIFO ring buffer.
+ *
+ * No allocation after construction and no reallocation ever: push refuses
+ * instead of growing, which makes backpressure explicit. The single-threaded
+ * building block for bounded queues.
+ */
+template <typename T, std::size_t N>
+class ring_buffer {
+    static_assert(N > 0, "ring_buffer needs a non-zero capacity");
+
+public:
+    ring_buffer() = default;
+    ring_buffer(const ring_buffer&) = delete;
+    ring_buffer& operator=(const ring_buffer&) = delete;
+    ~ring_buffer() { clear(); }
+
+    /// Returns false when full instead of overwriting or growing.
+    bool push(T value) {
+        if (size_ == N) return false;
+        ::new (slot(head_)) T(std::move(value));
+        head_ = next(head_);
+        ++size_;
+        return true;
+    }
+
+    /// Pops the oldest element into out; returns false when empty.
+    bool pop(T& out) {
+        if (size_ == 0) return false;
+        T* p = slot(tail_);
+        out = std::move(*p);
+        p->~T();
+        tail_ = next(tail_);
+        --size_;
+        return true;
+    }
+
+    void clear() {
+        while (size_ > 0) {
+            slot(tail_)->~T();
+            tail_ = next(tail_);
+            --size_;
+        }
+    }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    bool full() const { return size_ == N; }
+    static constexpr std::size_t capacity() { return N; }
+
+private:
+    static std::size_t next(std::size_t i) { return i + 1 == N ? 0 : i + 1; }
+    T* slot(std::size_t i) { return reinterpret_cast<T*>(storage_) + i; }
+
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+    std::size_t head_ = 0;
+    std::size_t tail_ = 0;
+    std::size_t size_ = 0;
+};
+
+}  // namespace %[2]s::core
+
+#endif  // %[1]s
+`, guard, safeName)
+}
+
+// GenerateSimdHeader generates include/<project>/simd.hpp, the public API of
+// the SIMD kernel scaffold: dispatched saxpy/dot entry points plus the
+// per-instruction-set variants for baselining. The variants come from one
+// translation unit (src/simd_kernels.cpp) compiled once per instruction set
+// by the generated build files; src/simd_dispatch.cpp resolves the widest
+// supported one at runtime.
+func GenerateSimdHeader(projectName string) string {
+	safeName := naming.SafeIdent(projectName)
+	guard := naming.SafeIdentUpper(projectName) + "_SIMD_HPP"
+	return fmt.Sprintf(`#ifndef %[1]s
+#define %[1]s
+
+#include <cstddef>
+
+namespace %[2]s::simd {
+
+/// y[i] = a * x[i] + y[i], dispatched to the widest instruction set the
+/// CPU supports (resolved once, on first call).
+void saxpy(float a, const float* x, float* y, std::size_t n);
+
+/// Dot product of x and y, dispatched like saxpy.
+float dot(const float* x, const float* y, std::size_t n);
+
+/// Name of the variant runtime dispatch selected ("avx2", "neon", ...).
+const char* active_target();
+
+// Per-instruction-set kernel variants. Each is src/simd_kernels.cpp compiled
+// with that instruction set's flags; call them directly only to baseline one
+// variant against another (the generated benchmarks do).
+namespace detail {
+
+void saxpy_scalar(float a, const float* x, float* y, std::size_t n);
+float dot_scalar(const float* x, const float* y, std::size_t n);
+
+#if defined(__x86_64__)
+void saxpy_sse2(float a, const float* x, float* y, std::size_t n);
+float dot_sse2(const float* x, const float* y, std::size_t n);
+void saxpy_avx2(float a, const float* x, float* y, std::size_t n);
+float dot_avx2(const float* x, const float* y, std::size_t n);
+void saxpy_avx512(float a, const float* x, float* y, std::size_t n);
+float dot_avx512(const float* x, const float* y, std::size_t n);
+#elif defined(__aarch64__)
+void saxpy_neon(float a, const float* x, float* y, std::size_t n);
+float dot_neon(const float* x, const float* y, std::size_t n);
+#endif
+
+}  // namespace detail
+
+}  // namespace %[2]s::simd
+
+#endif  // %[1]s
+`, guard, safeName)
+}
+
+// GenerateSimdKernels generates src/simd_kernels.cpp. The build system
+// compiles this file once per instruction set with CPX_SIMD_VARIANT set to
+// the variant name and the matching -m flags; the token-pasted function
+// names keep all variants linkable into one binary.
+func GenerateSimdKernels(projectName string) string {
+	safeName := naming.SafeIdent(projectName)
+	return fmt.Sprintf(`#include <%[1]s/simd.hpp>
+
+// One translation unit, compiled once per instruction set: the build file
+// defines CPX_SIMD_VARIANT and passes the matching -m flags, and the
+// autovectorizer emits the wide code. Keep the loops branch-free and
+// restrict-qualified so every variant vectorizes.
+
+#ifndef CPX_SIMD_VARIANT
+#define CPX_SIMD_VARIANT scalar
+#endif
+
+#define CPX_SIMD_PASTE(name, variant) name##_##variant
+#define CPX_SIMD_EXPAND(name, variant) CPX_SIMD_PASTE(name, variant)
+#define CPX_SIMD_FN(name) CPX_SIMD_EXPAND(name, CPX_SIMD_VARIANT)
+
+namespace %[2]s::simd::detail {
+
+void CPX_SIMD_FN(saxpy)(float a, const float* x, float* y, std::size_t n) {
+    const float* __restrict__ xs = x;
+    float* __restrict__ ys = y;
+    for (std::size_t i = 0; i < n; ++i) {
+        ys[i] = a * xs[i] + ys[i];
+    }
+}
+
+float CPX_SIMD_FN(dot)(const float* x, const float* y, std::size_t n) {
+    // Four accumulators break the serial FP dependency chain so the
+    // vectorizer can go wide without -ffast-math reassociation.
+    float acc0 = 0.0f;
+    float acc1 = 0.0f;
+    float acc2 = 0.0f;
+    float acc3 = 0.0f;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc0 += x[i] * y[i];
+        acc1 += x[i + 1] * y[i + 1];
+        acc2 += x[i + 2] * y[i + 2];
+        acc3 += x[i + 3] * y[i + 3];
+    }
+    float acc = (acc0 + acc1) + (acc2 + acc3);
+    for (; i < n; ++i) {
+        acc += x[i] * y[i];
+    }
+    return acc;
+}
+
+}  // namespace %[2]s::simd::detail
+`, projectName, safeName)
+}
+
+// GenerateSimdDispatch generates src/simd_dispatch.cpp, which resolves the
+// kernel table once to the widest variant the running CPU supports.
+func GenerateSimdDispatch(projectName string) string {
+	safeName := naming.SafeIdent(projectName)
+	return fmt.Sprintf(`#include <%[1]s/simd.hpp>
+
+// Runtime dispatch: resolved once, on first use. SSE2 is the x86-64
+// baseline and NEON the AArch64 baseline, so those never need a check.
+// __builtin_cpu_supports (GCC/Clang) handles the cpuid plumbing.
+
+namespace %[2]s::simd {
+namespace {
+
+using saxpy_fn = void (*)(float, const float*, float*, std::size_t);
+using dot_fn = float (*)(const float*, const float*, std::size_t);
+
+struct kernel_table {
+    saxpy_fn saxpy;
+    dot_fn dot;
+    const char* name;
+};
+
+kernel_table resolve() {
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("avx512f")) {
+        return {&detail::saxpy_avx512, &detail::dot_avx512, "avx512"};
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return {&detail::saxpy_avx2, &detail::dot_avx2, "avx2"};
+    }
+    return {&detail::saxpy_sse2, &detail::dot_sse2, "sse2"};
+#elif defined(__aarch64__)
+    return {&detail::saxpy_neon, &detail::dot_neon, "neon"};
+#else
+    return {&detail::saxpy_scalar, &detail::dot_scalar, "scalar"};
+#endif
+}
+
+const kernel_table& table() {
+    static const kernel_table t = resolve();
+    return t;
+}
+
+}  // namespace
+
+void saxpy(float a, const float* x, float* y, std::size_t n) {
+    table().saxpy(a, x, y, n);
+}
+
+float dot(const float* x, const float* y, std::size_t n) {
+    return table().dot(x, y, n);
+}
+
+const char* active_target() {
+    return table().name;
+}
+
+}  // namespace %[2]s::simd
+`, projectName, safeName)
+}
+
+func GenerateTestMain(projectName string, testingFramework string, perfCore bool) string {
 	safeName := naming.SafeIdent(projectName)
 	safeNameTitle := naming.SafeIdentTitle(projectName)
 	hasGtest := testingFramework == "googletest"
 	hasCatch2 := testingFramework == "catch2"
 	hasDoctest := testingFramework == "doctest"
 
+	coreInclude := ""
+	if perfCore {
+		coreInclude = fmt.Sprintf("#include <%s/core.hpp>\n", projectName)
+	}
+
 	if hasGtest {
-		return fmt.Sprintf(`#include <gtest/gtest.h>
+		main := fmt.Sprintf(`#include <gtest/gtest.h>
 #include <%s/%s.hpp>
-
+%s
 TEST(%sTest, VersionTest) {
     EXPECT_EQ(%s::version(), "1.0.0");
 }
@@ -126,11 +620,49 @@ TEST(%sTest, GreetTest) {
     // Should not throw
     EXPECT_NO_THROW(%s::greet());
 }
-`, projectName, projectName, safeNameTitle, safeName, safeNameTitle, safeName)
+`, projectName, projectName, coreInclude, safeNameTitle, safeName, safeNameTitle, safeName)
+		if perfCore {
+			main += fmt.Sprintf(`
+TEST(%[1]sCoreTest, ArenaAlignsAndReuses) {
+    %[2]s::core::arena a(256);
+    void* p1 = a.allocate(24, 16);
+    void* p2 = a.allocate(24, 16);
+    EXPECT_NE(p1, p2);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p1) %% 16, 0u);
+    a.reset();
+    // reset rewinds to the first block, so the same address comes back
+    EXPECT_EQ(a.allocate(24, 16), p1);
+}
+
+TEST(%[1]sCoreTest, SmallVectorSpillsToHeap) {
+    %[2]s::core::small_vector<int, 4> v;
+    for (int i = 0; i < 4; ++i) v.push_back(i);
+    EXPECT_FALSE(v.on_heap());
+    for (int i = 4; i < 8; ++i) v.push_back(i);
+    EXPECT_TRUE(v.on_heap());
+    ASSERT_EQ(v.size(), 8u);
+    for (int i = 0; i < 8; ++i) EXPECT_EQ(v[i], i);
+}
+
+TEST(%[1]sCoreTest, RingBufferIsFifoAndBounded) {
+    %[2]s::core::ring_buffer<int, 2> rb;
+    EXPECT_TRUE(rb.push(1));
+    EXPECT_TRUE(rb.push(2));
+    EXPECT_FALSE(rb.push(3));  // full: rejects instead of overwriting
+    int out = 0;
+    EXPECT_TRUE(rb.pop(out));
+    EXPECT_EQ(out, 1);
+    EXPECT_TRUE(rb.pop(out));
+    EXPECT_EQ(out, 2);
+    EXPECT_FALSE(rb.pop(out));
+}
+`, safeNameTitle, safeName)
+		}
+		return main
 	} else if hasCatch2 {
-		return fmt.Sprintf(`#include <catch2/catch_test_macros.hpp>
+		main := fmt.Sprintf(`#include <catch2/catch_test_macros.hpp>
 #include <%s/%s.hpp>
-
+%s
 TEST_CASE("%s::version returns correct version", "[version]") {
     REQUIRE(%s::version() == "1.0.0");
 }
@@ -138,12 +670,50 @@ TEST_CASE("%s::version returns correct version", "[version]") {
 TEST_CASE("%s::greet does not throw", "[greet]") {
     REQUIRE_NOTHROW(%s::greet());
 }
-`, projectName, projectName, safeName, safeName, safeName, safeName)
+`, projectName, projectName, coreInclude, safeName, safeName, safeName, safeName)
+		if perfCore {
+			main += fmt.Sprintf(`
+TEST_CASE("core::arena aligns and reuses on reset", "[core]") {
+    %[1]s::core::arena a(256);
+    void* p1 = a.allocate(24, 16);
+    void* p2 = a.allocate(24, 16);
+    REQUIRE(p1 != p2);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p1) %% 16 == 0);
+    a.reset();
+    // reset rewinds to the first block, so the same address comes back
+    REQUIRE(a.allocate(24, 16) == p1);
+}
+
+TEST_CASE("core::small_vector spills to the heap past N", "[core]") {
+    %[1]s::core::small_vector<int, 4> v;
+    for (int i = 0; i < 4; ++i) v.push_back(i);
+    REQUIRE_FALSE(v.on_heap());
+    for (int i = 4; i < 8; ++i) v.push_back(i);
+    REQUIRE(v.on_heap());
+    REQUIRE(v.size() == 8);
+    for (int i = 0; i < 8; ++i) REQUIRE(v[i] == i);
+}
+
+TEST_CASE("core::ring_buffer is FIFO and bounded", "[core]") {
+    %[1]s::core::ring_buffer<int, 2> rb;
+    REQUIRE(rb.push(1));
+    REQUIRE(rb.push(2));
+    REQUIRE_FALSE(rb.push(3));  // full: rejects instead of overwriting
+    int out = 0;
+    REQUIRE(rb.pop(out));
+    REQUIRE(out == 1);
+    REQUIRE(rb.pop(out));
+    REQUIRE(out == 2);
+    REQUIRE_FALSE(rb.pop(out));
+}
+`, safeName)
+		}
+		return main
 	} else if hasDoctest {
-		return fmt.Sprintf(`#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+		main := fmt.Sprintf(`#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest/doctest.h>
 #include <%s/%s.hpp>
-
+%s
 TEST_CASE("testing version") {
     CHECK(%s::version() == "1.0.0");
 }
@@ -151,28 +721,143 @@ TEST_CASE("testing version") {
 TEST_CASE("testing greet") {
     CHECK_NOTHROW(%s::greet());
 }
-`, projectName, projectName, safeName, safeName)
+`, projectName, projectName, coreInclude, safeName, safeName)
+		if perfCore {
+			main += fmt.Sprintf(`
+TEST_CASE("testing core::arena") {
+    %[1]s::core::arena a(256);
+    void* p1 = a.allocate(24, 16);
+    void* p2 = a.allocate(24, 16);
+    CHECK(p1 != p2);
+    CHECK(reinterpret_cast<std::uintptr_t>(p1) %% 16 == 0);
+    a.reset();
+    // reset rewinds to the first block, so the same address comes back
+    CHECK(a.allocate(24, 16) == p1);
+}
+
+TEST_CASE("testing core::small_vector") {
+    %[1]s::core::small_vector<int, 4> v;
+    for (int i = 0; i < 4; ++i) v.push_back(i);
+    CHECK_FALSE(v.on_heap());
+    for (int i = 4; i < 8; ++i) v.push_back(i);
+    CHECK(v.on_heap());
+    CHECK(v.size() == 8);
+    for (int i = 0; i < 8; ++i) CHECK(v[i] == i);
+}
+
+TEST_CASE("testing core::ring_buffer") {
+    %[1]s::core::ring_buffer<int, 2> rb;
+    CHECK(rb.push(1));
+    CHECK(rb.push(2));
+    CHECK_FALSE(rb.push(3));  // full: rejects instead of overwriting
+    int out = 0;
+    CHECK(rb.pop(out));
+    CHECK(out == 1);
+    CHECK(rb.pop(out));
+    CHECK(out == 2);
+    CHECK_FALSE(rb.pop(out));
+}
+`, safeName)
+		}
+		return main
 	} else {
-		return fmt.Sprintf(`// Basic test file - add a test framework for better testing support
+		main := fmt.Sprintf(`// Basic test file - add a test framework for better testing support
 #include <%s/%s.hpp>
-#include <cassert>
+%s#include <cassert>
 #include <iostream>
 
 int main() {
     assert(%s::version() == "1.0.0");
     %s::greet();
-    std::cout << "All tests passed!" << std::endl;
+`, projectName, projectName, coreInclude, safeName, safeName)
+		if perfCore {
+			main += fmt.Sprintf(`
+    %[1]s::core::arena a(256);
+    void* p1 = a.allocate(24, 16);
+    assert(p1 != a.allocate(24, 16));
+    a.reset();
+    assert(a.allocate(24, 16) == p1);
+
+    %[1]s::core::small_vector<int, 4> v;
+    for (int i = 0; i < 8; ++i) v.push_back(i);
+    assert(v.size() == 8 && v.on_heap());
+
+    %[1]s::core::ring_buffer<int, 2> rb;
+    assert(rb.push(1) && rb.push(2) && !rb.push(3));
+    int out = 0;
+    assert(rb.pop(out) && out == 1);
+`, safeName)
+		}
+		main += `    std::cout << "All tests passed!" << std::endl;
     return 0;
 }
-`, projectName, projectName, safeName, safeName)
+`
+		return main
 	}
 }
 
+// GeneratePchHeader generates a precompiled header (pch.hpp) with the
+// standard-library workhorses plus the chosen test/bench framework headers.
+// Framework includes are guarded with __has_include so the same header
+// compiles for targets that do not link the framework.
+func GeneratePchHeader(testFramework, benchmarkFramework string) string {
+	var sb strings.Builder
+	sb.WriteString(`// Precompiled header - generated by cpx
+// Keep this limited to stable, widely-used headers: every change here
+// triggers a full rebuild of the targets that use it.
+#pragma once
+
+// Standard library workhorses
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+`)
+
+	var frameworkHeaders []string
+	switch testFramework {
+	case "googletest":
+		frameworkHeaders = append(frameworkHeaders, "<gtest/gtest.h>", "<gmock/gmock.h>")
+	case "catch2":
+		frameworkHeaders = append(frameworkHeaders, "<catch2/catch_test_macros.hpp>")
+	case "doctest":
+		frameworkHeaders = append(frameworkHeaders, "<doctest/doctest.h>")
+	}
+	switch benchmarkFramework {
+	case "google-benchmark":
+		frameworkHeaders = append(frameworkHeaders, "<benchmark/benchmark.h>")
+	case "nanobench":
+		frameworkHeaders = append(frameworkHeaders, "<nanobench.h>")
+	case "catch2-benchmark":
+		if testFramework != "catch2" {
+			frameworkHeaders = append(frameworkHeaders, "<catch2/catch_all.hpp>")
+		}
+	}
+
+	if len(frameworkHeaders) > 0 {
+		sb.WriteString("\n// Test/benchmark framework headers\n")
+		for _, hdr := range frameworkHeaders {
+			sb.WriteString(fmt.Sprintf("#if __has_include(%s)\n#include %s\n#endif\n", hdr, hdr))
+		}
+	}
+
+	return sb.String()
+}
+
 // ============================================================================
 // CMAKE TEMPLATES
 // ============================================================================
 
-func GenerateVcpkgCMakeLists(projectName string, cppStandard int, isExe bool, includeTests bool, benchmarkFramework string, includeBench bool, projectVersion string) string {
+func GenerateVcpkgCMakeLists(projectName string, cppStandard int, isExe bool, includeTests bool, benchmarkFramework string, includeBench bool, projectVersion string, usePch bool, simd bool) string {
 	var sb strings.Builder
 
 	sb.WriteString(fmt.Sprintf(`cmake_minimum_required(VERSION 3.20)
@@ -186,6 +871,14 @@ set(CMAKE_CXX_EXTENSIONS OFF)
 # Export compile commands for IDE support
 set(CMAKE_EXPORT_COMPILE_COMMANDS ON)
 
+# Unity (jumbo) build: batches source files per target to cut per-TU overhead
+# Enable with -DENABLE_UNITY_BUILD=ON (cpx build --unity does this for you)
+option(ENABLE_UNITY_BUILD "Enable unity (jumbo) builds" OFF)
+if(ENABLE_UNITY_BUILD)
+    set(CMAKE_UNITY_BUILD ON)
+    set(CMAKE_UNITY_BUILD_BATCH_SIZE 16)
+endif()
+
 `, projectName, projectVersion, cppStandard))
 
 	if isExe {
@@ -216,6 +909,40 @@ target_include_directories(%s
 `, projectName, projectName, projectName))
 	}
 
+	if simd {
+		sb.WriteString(`# SIMD kernel variants: src/simd_kernels.cpp compiled once per instruction
+# set; src/simd_dispatch.cpp picks the widest one the CPU supports at runtime
+function(add_simd_variant name)
+    add_library(${PROJECT_NAME}_simd_${name} OBJECT src/simd_kernels.cpp)
+    target_compile_definitions(${PROJECT_NAME}_simd_${name} PRIVATE CPX_SIMD_VARIANT=${name})
+    target_compile_options(${PROJECT_NAME}_simd_${name} PRIVATE ${ARGN})
+    target_include_directories(${PROJECT_NAME}_simd_${name} PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/include)
+    set(SIMD_OBJECTS ${SIMD_OBJECTS} $<TARGET_OBJECTS:${PROJECT_NAME}_simd_${name}> PARENT_SCOPE)
+endfunction()
+
+add_simd_variant(scalar)
+if(CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64")
+    add_simd_variant(sse2 -msse2)
+    add_simd_variant(avx2 -mavx2 -mfma)
+    add_simd_variant(avx512 -mavx512f -mfma)
+elseif(CMAKE_SYSTEM_PROCESSOR MATCHES "aarch64|arm64")
+    # NEON is the AArch64 baseline, no extra flags needed
+    add_simd_variant(neon)
+endif()
+
+`)
+		sb.WriteString(fmt.Sprintf(`target_sources(%s PRIVATE src/simd_dispatch.cpp ${SIMD_OBJECTS})
+
+`, projectName))
+	}
+
+	if usePch {
+		sb.WriteString(fmt.Sprintf(`# Precompiled header (std-library workhorses + framework headers)
+target_precompile_headers(%s PRIVATE src/pch.hpp)
+
+`, projectName))
+	}
+
 	if includeTests {
 		sb.WriteString(`# Testing
 enable_testing()
@@ -249,13 +976,29 @@ func GenerateCMakePresets() string {
       "cacheVariables": {
         "CMAKE_TOOLCHAIN_FILE": "$env{VCPKG_ROOT}/scripts/buildsystems/vcpkg.cmake"
       }
+    },
+    {
+      "name": "ccache",
+      "inherits": "default",
+      "cacheVariables": {
+        "CMAKE_C_COMPILER_LAUNCHER": "ccache",
+        "CMAKE_CXX_COMPILER_LAUNCHER": "ccache"
+      }
+    },
+    {
+      "name": "sccache",
+      "inherits": "default",
+      "cacheVariables": {
+        "CMAKE_C_COMPILER_LAUNCHER": "sccache",
+        "CMAKE_CXX_COMPILER_LAUNCHER": "sccache"
+      }
     }
   ]
 }
 `
 }
 
-func GenerateTestCMake(projectName string, testingFramework string) string {
+func GenerateTestCMake(projectName string, testingFramework string, usePch bool) string {
 	hasGtest := testingFramework == "googletest"
 	hasCatch2 := testingFramework == "catch2"
 	hasDoctest := testingFramework == "doctest"
@@ -275,6 +1018,13 @@ target_include_directories(%s_tests
 
 `, projectName, projectName, projectName, projectName))
 
+	if usePch {
+		sb.WriteString(fmt.Sprintf(`# Precompiled header (pulls in the test framework headers too)
+target_precompile_headers(%s_tests PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/../src/pch.hpp)
+
+`, projectName))
+	}
+
 	// Use FetchContent for testing frameworks
 	if hasGtest {
 		sb.WriteString(`# Fetch googletest
@@ -328,7 +1078,7 @@ FetchContent_MakeAvailable(doctest)
 }
 
 // GenerateBenchCMake generates bench/CMakeLists.txt with FetchContent for benchmark frameworks
-func GenerateBenchCMake(projectName string, benchmarkFramework string) string {
+func GenerateBenchCMake(projectName string, benchmarkFramework string, simd bool) string {
 	hasGoogleBench := false
 	hasCatch2Bench := false
 	hasNanoBench := false
@@ -343,12 +1093,20 @@ func GenerateBenchCMake(projectName string, benchmarkFramework string) string {
 		hasNanoBench = true
 	}
 
+	// The SIMD scaffold's bench compares the scalar and dispatched kernels,
+	// so the bench target needs the dispatcher and the per-variant objects
+	// built in the top-level CMakeLists
+	simdSrc := ""
+	if simd {
+		simdSrc = "\n    ${CMAKE_CURRENT_SOURCE_DIR}/../src/simd_dispatch.cpp"
+	}
+
 	var sb strings.Builder
 	sb.WriteString(fmt.Sprintf(`# Benchmark configuration for %s
 
 add_executable(%s_bench
     bench_main.cpp
-    ${CMAKE_CURRENT_SOURCE_DIR}/../src/%s.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/%s.cpp%s
 )
 
 target_include_directories(%s_bench
@@ -356,7 +1114,12 @@ target_include_directories(%s_bench
         ${CMAKE_CURRENT_SOURCE_DIR}/../include
 )
 
-`, projectName, projectName, projectName, projectName))
+`, projectName, projectName, projectName, simdSrc, projectName))
+	if simd {
+		sb.WriteString(fmt.Sprintf(`target_sources(%s_bench PRIVATE ${SIMD_OBJECTS})
+
+`, projectName))
+	}
 
 	// Use FetchContent for benchmark frameworks
 	if hasGoogleBench {
@@ -493,6 +1256,11 @@ func GenerateCpxCI() string {
 	return `# cpx.ci - Cross-compilation configuration
 # This file defines which Docker images to use for building your project
 # Add targets to build for different platforms
+#
+# Each target keeps persistent caches under .cache/ci/<target>/ on the host:
+# vcpkg downloads, buildtrees and binary cache plus a ccache directory, all
+# mounted into the container so repeat builds skip dependency rebuilds and
+# unchanged compilations. Delete a target's cache directory to start cold.
 
 # List of targets to build
 targets:
@@ -693,15 +1461,93 @@ alias(
 }
 
 // GenerateBuildBazelSrc generates src/BUILD.bazel
-func GenerateBuildBazelSrc(projectName string, isExe bool) string {
+func GenerateBuildBazelSrc(projectName string, isExe bool, simd bool) string {
+	simdTargets := ""
+	if simd {
+		simdTargets = fmt.Sprintf(`
+# SIMD kernel variants: simd_kernels.cpp compiled once per instruction set;
+# the dispatch library resolves the widest supported one at runtime
+cc_library(
+    name = "simd_kernels_scalar",
+    srcs = ["simd_kernels.cpp"],
+    local_defines = ["CPX_SIMD_VARIANT=scalar"],
+    deps = ["//include:%[1]s_headers"],
+)
+
+cc_library(
+    name = "simd_kernels_sse2",
+    srcs = ["simd_kernels.cpp"],
+    copts = ["-msse2"],
+    local_defines = ["CPX_SIMD_VARIANT=sse2"],
+    deps = ["//include:%[1]s_headers"],
+)
+
+cc_library(
+    name = "simd_kernels_avx2",
+    srcs = ["simd_kernels.cpp"],
+    copts = [
+        "-mavx2",
+        "-mfma",
+    ],
+    local_defines = ["CPX_SIMD_VARIANT=avx2"],
+    deps = ["//include:%[1]s_headers"],
+)
+
+cc_library(
+    name = "simd_kernels_avx512",
+    srcs = ["simd_kernels.cpp"],
+    copts = [
+        "-mavx512f",
+        "-mfma",
+    ],
+    local_defines = ["CPX_SIMD_VARIANT=avx512"],
+    deps = ["//include:%[1]s_headers"],
+)
+
+# NEON is the AArch64 baseline, no extra flags needed
+cc_library(
+    name = "simd_kernels_neon",
+    srcs = ["simd_kernels.cpp"],
+    local_defines = ["CPX_SIMD_VARIANT=neon"],
+    deps = ["//include:%[1]s_headers"],
+)
+
+cc_library(
+    name = "simd",
+    srcs = ["simd_dispatch.cpp"],
+    deps = [
+        ":simd_kernels_scalar",
+        "//include:%[1]s_headers",
+    ] + select({
+        "@platforms//cpu:x86_64": [
+            ":simd_kernels_sse2",
+            ":simd_kernels_avx2",
+            ":simd_kernels_avx512",
+        ],
+        "@platforms//cpu:aarch64": [":simd_kernels_neon"],
+        "//conditions:default": [],
+    }),
+    visibility = ["//visibility:public"],
+)
+`, projectName)
+	}
+
+	libDeps := fmt.Sprintf(`["//include:%s_headers"]`, projectName)
+	if simd {
+		libDeps = fmt.Sprintf(`[
+        ":simd",
+        "//include:%s_headers",
+    ]`, projectName)
+	}
+
 	if isExe {
 		return fmt.Sprintf(`load("@rules_cc//cc:defs.bzl", "cc_binary", "cc_library")
-
+%s
 # Core library
 cc_library(
     name = "%s_lib",
     srcs = ["%s.cpp"],
-    deps = ["//include:%s_headers"],
+    deps = %s,
     visibility = ["//visibility:public"],
 )
 
@@ -712,18 +1558,18 @@ cc_binary(
     deps = [":%s_lib"],
     visibility = ["//visibility:public"],
 )
-`, projectName, projectName, projectName, projectName, projectName)
+`, simdTargets, projectName, projectName, libDeps, projectName, projectName)
 	}
 	return fmt.Sprintf(`load("@rules_cc//cc:defs.bzl", "cc_library")
-
+%s
 # Core library
 cc_library(
     name = "%s",
     srcs = ["%s.cpp"],
-    deps = ["//include:%s_headers"],
+    deps = %s,
     visibility = ["//visibility:public"],
 )
-`, projectName, projectName, projectName)
+`, simdTargets, projectName, projectName, libDeps)
 }
 
 // GenerateBuildBazelInclude generates include/BUILD.bazel
@@ -805,7 +1651,10 @@ func GenerateBuildBazelBench(projectName, benchmarkFramework string) string {
 
 cc_binary(
     name = "%s_bench",
-    srcs = ["bench_main.cpp"],
+    srcs = [
+        "bench_main.cpp",
+        "perf_counters.hpp",
+    ],
     deps = [
         "//src:%s_lib",
         "@google_benchmark//:benchmark_main",
@@ -818,7 +1667,10 @@ cc_binary(
 
 cc_binary(
     name = "%s_bench",
-    srcs = ["bench_main.cpp"],
+    srcs = [
+        "bench_main.cpp",
+        "perf_counters.hpp",
+    ],
     deps = [
         "//src:%s_lib",
         "@nanobench//:nanobench",
@@ -831,7 +1683,10 @@ cc_binary(
 
 cc_binary(
     name = "%s_bench",
-    srcs = ["bench_main.cpp"],
+    srcs = [
+        "bench_main.cpp",
+        "perf_counters.hpp",
+    ],
     deps = [
         "//src:%s_lib",
         "@catch2//:catch2_main",
@@ -845,7 +1700,10 @@ cc_binary(
 
 cc_binary(
     name = "%s_bench",
-    srcs = ["bench_main.cpp"],
+    srcs = [
+        "bench_main.cpp",
+        "perf_counters.hpp",
+    ],
     deps = [
         "//src:%s_lib",
     ],
@@ -865,10 +1723,25 @@ build --symlink_prefix=.
 # Enable optimizations for release builds
 build:release --compilation_mode=opt
 
+# ThinLTO release profile (cpx build --lto uses this)
+build:lto --compilation_mode=opt
+build:lto --features=thin_lto
+
+# Fast linker profiles (cpx build --linker passes the flag directly)
+build:mold --linkopt=-fuse-ld=mold
+build:lld --linkopt=-fuse-ld=lld
+
 # Debug build configuration
 build:debug --compilation_mode=dbg
 build:debug --cxxopt=-g
 
+# Remote execution (cpx build --remote uses this config).
+# Fill in your build farm's endpoints to enable it:
+# build:remote --remote_executor=grpc://buildfarm:8980
+# build:remote --remote_cache=grpc://buildfarm:8980
+# build:remote --jobs=200
+build:remote --remote_download_minimal
+
 # Enable colored output
 build --color=yes
 
@@ -1062,11 +1935,47 @@ summary({
 }
 
 // GenerateMesonBuildSrc generates src/meson.build
-func GenerateMesonBuildSrc(projectName string, isExe bool) string {
+func GenerateMesonBuildSrc(projectName string, isExe bool, usePch bool, simd bool) string {
 	safeName := naming.SafeIdent(projectName)
 
+	// Meson requires the PCH to live in its own directory (src/pch/pch.hpp)
+	pchArg := ""
+	if usePch {
+		pchArg = ",\n  cpp_pch : 'pch/pch.hpp'"
+	}
+
+	// SIMD kernel variants: one static lib per instruction set, folded into
+	// the project library with link_whole so every consumer gets them
+	simdBlock := ""
+	libSources := fmt.Sprintf("files('%s.cpp')", projectName)
+	simdLink := ""
+	if simd {
+		simdBlock = `# SIMD kernel variants: simd_kernels.cpp compiled once per instruction set;
+# simd_dispatch.cpp picks the widest one the CPU supports at runtime
+simd_variants = [['scalar', []]]
+if host_machine.cpu_family() == 'x86_64'
+  simd_variants += [['sse2', ['-msse2']], ['avx2', ['-mavx2', '-mfma']], ['avx512', ['-mavx512f', '-mfma']]]
+elif host_machine.cpu_family() == 'aarch64'
+  # NEON is the AArch64 baseline, no extra flags needed
+  simd_variants += [['neon', []]]
+endif
+
+simd_libs = []
+foreach v : simd_variants
+  simd_libs += static_library('simd_' + v[0],
+    files('simd_kernels.cpp'),
+    cpp_args : ['-DCPX_SIMD_VARIANT=' + v[0]] + v[1],
+    include_directories : inc_dirs
+  )
+endforeach
+
+`
+		libSources = fmt.Sprintf("files('%s.cpp', 'simd_dispatch.cpp')", projectName)
+		simdLink = ",\n  link_whole : simd_libs"
+	}
+
 	if isExe {
-		return fmt.Sprintf(`# Source files
+		return fmt.Sprintf(`%s# Source files
 src_files = files(
   'main.cpp',
   '%s.cpp'
@@ -1074,33 +1983,31 @@ src_files = files(
 
 # Library (for linking by tests/benchmarks)
 %s_lib = static_library('%s_lib',
-  files('%s.cpp'),
+  %s,
   include_directories : inc_dirs,
-  install : true
+  install : true%s%s
 )
 
 # Executable
 %s_exe = executable('%s',
   src_files,
   include_directories : inc_dirs,
-  install : true
+  install : true%s
 )
-`, projectName, safeName, safeName, projectName, safeName, projectName)
+`, simdBlock, projectName, safeName, safeName, libSources, simdLink, pchArg, safeName, projectName, pchArg)
 	}
 
 	// Library only (static by default)
-	return fmt.Sprintf(`# Source files
-src_files = files(
-  '%s.cpp'
-)
+	return fmt.Sprintf(`%s# Source files
+src_files = %s
 
 # Library (static by default)
 %s_lib = static_library('%s',
   src_files,
   include_directories : inc_dirs,
-  install : true
+  install : true%s%s
 )
-`, projectName, safeName, projectName)
+`, simdBlock, libSources, safeName, projectName, simdLink, pchArg)
 }
 
 // GenerateMesonBuildTests generates tests/meson.build
@@ -1196,6 +2103,14 @@ option('enable_tests', type : 'boolean', value : true,
 
 option('enable_benchmarks', type : 'boolean', value : true,
        description : 'Enable building benchmarks')
+
+# Link-time optimization uses the builtin options, e.g.:
+#   meson setup builddir -Db_lto=true -Db_lto_mode=thin
+# (cpx build --lto wires this up for you)
+
+# Fast linkers use the builtin link args, e.g.:
+#   meson setup builddir -Dcpp_link_args=-fuse-ld=mold
+# (cpx build --linker wires this up for you)
 `
 }
 
@@ -1322,33 +2237,192 @@ MIT
 
 // BenchSources holds generated benchmark source files
 type BenchSources struct {
-	Main string
+	Main       string
+	PerfHeader string
 }
 
 // GenerateBenchmarkSources generates benchmark source files based on framework
-func GenerateBenchmarkSources(projectName, benchmarkFramework string) (*BenchSources, []string) {
+// GenerateBenchmarkSources picks the bench_main.cpp that matches the chosen
+// scaffold options. The SIMD scaffold's scalar-vs-dispatch comparison takes
+// precedence over the core benchmarks when both are selected; the bench file
+// is a starting point either way.
+func GenerateBenchmarkSources(projectName, benchmarkFramework string, perfCore bool, simd bool) (*BenchSources, []string) {
 	safeName := SafeIdent(projectName)
 
 	switch benchmarkFramework {
 	case "google-benchmark":
-		return &BenchSources{Main: generateGoogleBenchMain(projectName, safeName)}, []string{"benchmark"}
+		main := generateGoogleBenchMain(projectName, safeName)
+		if simd {
+			main = generateGoogleBenchSimdMain(projectName, safeName)
+		} else if perfCore {
+			main = generateGoogleBenchCoreMain(projectName, safeName)
+		}
+		return &BenchSources{Main: main, PerfHeader: generatePerfCountersHeader(safeName)}, []string{"benchmark"}
 	case "nanobench":
-		return &BenchSources{Main: generateNanoBenchMain(projectName, safeName)}, []string{"nanobench"}
+		main := generateNanoBenchMain(projectName, safeName)
+		if simd {
+			main = generateNanoBenchSimdMain(projectName, safeName)
+		} else if perfCore {
+			main = generateNanoBenchCoreMain(projectName, safeName)
+		}
+		return &BenchSources{Main: main, PerfHeader: generatePerfCountersHeader(safeName)}, []string{"nanobench"}
 	case "catch2-benchmark":
-		return &BenchSources{Main: generateCatch2BenchMain(projectName, safeName)}, []string{"catch2"}
+		main := generateCatch2BenchMain(projectName, safeName)
+		if simd {
+			main = generateCatch2BenchSimdMain(projectName, safeName)
+		} else if perfCore {
+			main = generateCatch2BenchCoreMain(projectName, safeName)
+		}
+		return &BenchSources{Main: main, PerfHeader: generatePerfCountersHeader(safeName)}, []string{"catch2"}
 	default:
 		return nil, nil
 	}
 }
 
+// generatePerfCountersHeader generates bench/perf_counters.hpp, a small
+// perf_event_open wrapper that reads cycles, instructions, branch misses and
+// LLC misses around a benchmark. Wall-clock alone is noisy on shared runners;
+// IPC and cache-miss rates show whether a data-layout change actually helped.
+// Degrades to an invalid (unreported) reading off Linux or when perf_event
+// access is restricted (e.g. containers with perf_event_paranoid > 2).
+func generatePerfCountersHeader(safeName string) string {
+	return fmt.Sprintf(`#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace %s::bench {
+
+// One reading of the hardware counters. valid is false when the counters
+// could not be opened (non-Linux, or perf_event access restricted).
+struct PerfCounts {
+    std::uint64_t cycles = 0;
+    std::uint64_t instructions = 0;
+    std::uint64_t branch_misses = 0;
+    std::uint64_t llc_misses = 0;
+    bool valid = false;
+
+    double ipc() const {
+        return cycles > 0 ? static_cast<double>(instructions) / static_cast<double>(cycles) : 0.0;
+    }
+};
+
+// RAII wrapper around a perf_event_open counter group. Usage:
+//
+//     PerfCounters counters;
+//     counters.start();
+//     // ... hot code ...
+//     PerfCounts counts = counters.stop();
+class PerfCounters {
+public:
+#if defined(__linux__)
+    PerfCounters() {
+        fds_[0] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+        fds_[1] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, fds_[0]);
+        fds_[2] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, fds_[0]);
+        fds_[3] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, fds_[0]);
+    }
+
+    ~PerfCounters() {
+        for (int fd : fds_) {
+            if (fd >= 0) close(fd);
+        }
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    void start() {
+        if (fds_[0] < 0) return;
+        ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    PerfCounts stop() {
+        PerfCounts counts;
+        if (fds_[0] < 0) return counts;
+        ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        counts.valid = read_counter(fds_[0], counts.cycles) &&
+                       read_counter(fds_[1], counts.instructions) &&
+                       read_counter(fds_[2], counts.branch_misses) &&
+                       read_counter(fds_[3], counts.llc_misses);
+        return counts;
+    }
+
+private:
+    static int open_event(std::uint32_t type, std::uint64_t config, int group_fd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = type;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+
+    static bool read_counter(int fd, std::uint64_t& value) {
+        return fd >= 0 && read(fd, &value, sizeof(value)) == sizeof(value);
+    }
+
+    int fds_[4] = {-1, -1, -1, -1};
+#else
+    void start() {}
+    PerfCounts stop() { return PerfCounts{}; }
+#endif
+};
+
+// Prints a per-iteration counter summary, or a hint when counters are
+// unavailable. iterations may be 1 to report raw totals.
+inline void report(const char* name, const PerfCounts& counts, std::uint64_t iterations) {
+    if (!counts.valid) {
+        std::fprintf(stderr, "[perf] %%s: hardware counters unavailable (non-Linux or perf_event_paranoid too strict)\n", name);
+        return;
+    }
+    if (iterations == 0) iterations = 1;
+    std::printf("[perf] %%s: %%.1f cycles/iter, %%.1f instrs/iter, IPC %%.2f, %%.2f branch-misses/iter, %%.2f LLC-misses/iter\n",
+                name,
+                static_cast<double>(counts.cycles) / static_cast<double>(iterations),
+                static_cast<double>(counts.instructions) / static_cast<double>(iterations),
+                counts.ipc(),
+                static_cast<double>(counts.branch_misses) / static_cast<double>(iterations),
+                static_cast<double>(counts.llc_misses) / static_cast<double>(iterations));
+}
+
+}  // namespace %s::bench
+`, safeName, safeName)
+}
+
 func generateGoogleBenchMain(projectName, safeName string) string {
 	return fmt.Sprintf(`#include <benchmark/benchmark.h>
 #include <%s/%s.hpp>
 
+#include "perf_counters.hpp"
+
 static void BM_version(benchmark::State& state) {
+    %s::bench::PerfCounters counters;
+    counters.start();
     for (auto _ : state) {
         benchmark::DoNotOptimize(%s::version());
     }
+    auto counts = counters.stop();
+    if (counts.valid) {
+        using benchmark::Counter;
+        state.counters["cycles"] = Counter(static_cast<double>(counts.cycles), Counter::kAvgIterations);
+        state.counters["instructions"] = Counter(static_cast<double>(counts.instructions), Counter::kAvgIterations);
+        state.counters["IPC"] = Counter(counts.ipc());
+        state.counters["branch-misses"] = Counter(static_cast<double>(counts.branch_misses), Counter::kAvgIterations);
+        state.counters["LLC-misses"] = Counter(static_cast<double>(counts.llc_misses), Counter::kAvgIterations);
+    }
 }
 
 BENCHMARK(BM_version);
@@ -1358,7 +2432,7 @@ int main(int argc, char** argv) {
     if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
     benchmark::RunSpecifiedBenchmarks();
 }
-`, projectName, projectName, safeName)
+`, projectName, projectName, safeName, safeName)
 }
 
 func generateNanoBenchMain(projectName, safeName string) string {
@@ -1366,26 +2440,414 @@ func generateNanoBenchMain(projectName, safeName string) string {
 #include <%s/%s.hpp>
 #include <iostream>
 
+#include "perf_counters.hpp"
+
 int main() {
+    // nanobench reports ins/op, cyc/op and IPC natively when perf counters
+    // are readable; the fixture below adds branch and LLC misses as well.
     ankerl::nanobench::Bench bench;
+
+    %s::bench::PerfCounters counters;
+    counters.start();
     bench.run("version", [] {
         ankerl::nanobench::doNotOptimizeAway(%s::version());
     });
+    auto counts = counters.stop();
+
+    std::uint64_t iterations = 0;
+    for (const auto& result : bench.results()) {
+        iterations += static_cast<std::uint64_t>(result.sum(ankerl::nanobench::Result::Measure::iterations));
+    }
+    %s::bench::report("version", counts, iterations);
     return 0;
 }
-`, projectName, projectName, safeName)
+`, projectName, projectName, safeName, safeName, safeName)
 }
 
 func generateCatch2BenchMain(projectName, safeName string) string {
 	return fmt.Sprintf(`#include <catch2/catch_all.hpp>
 #include <%s/%s.hpp>
 
+#include "perf_counters.hpp"
+
 TEST_CASE("Benchmark version", "[benchmark]") {
+    %s::bench::PerfCounters counters;
+    std::uint64_t iterations = 0;
+
+    counters.start();
     BENCHMARK("version") {
+        ++iterations;
         return %s::version();
     };
+    %s::bench::report("version", counters.stop(), iterations);
 }
-`, projectName, projectName, safeName)
+`, projectName, projectName, safeName, safeName, safeName)
+}
+
+// generateGoogleBenchCoreMain benchmarks the high-performance core scaffold
+// (arena vs operator new, small_vector fill, ring_buffer cycle). The arena
+// benchmark carries the hardware counters so IPC and cache misses are visible
+// for the allocation-heavy path.
+func generateGoogleBenchCoreMain(projectName, safeName string) string {
+	return fmt.Sprintf(`#include <benchmark/benchmark.h>
+#include <%[1]s/core.hpp>
+
+#include "perf_counters.hpp"
+
+namespace core = %[2]s::core;
+
+static void BM_arena_allocate(benchmark::State& state) {
+    core::arena arena;
+    %[2]s::bench::PerfCounters counters;
+    counters.start();
+    for (auto _ : state) {
+        for (int i = 0; i < 1024; ++i) {
+            benchmark::DoNotOptimize(arena.allocate(32, 16));
+        }
+        arena.reset();
+    }
+    auto counts = counters.stop();
+    state.SetItemsProcessed(state.iterations() * 1024);
+    if (counts.valid) {
+        using benchmark::Counter;
+        state.counters["cycles"] = Counter(static_cast<double>(counts.cycles), Counter::kAvgIterations);
+        state.counters["instructions"] = Counter(static_cast<double>(counts.instructions), Counter::kAvgIterations);
+        state.counters["IPC"] = Counter(counts.ipc());
+        state.counters["branch-misses"] = Counter(static_cast<double>(counts.branch_misses), Counter::kAvgIterations);
+        state.counters["LLC-misses"] = Counter(static_cast<double>(counts.llc_misses), Counter::kAvgIterations);
+    }
+}
+BENCHMARK(BM_arena_allocate);
+
+// Baseline the arena against: same allocation pattern through the system
+// allocator.
+static void BM_new_delete(benchmark::State& state) {
+    for (auto _ : state) {
+        for (int i = 0; i < 1024; ++i) {
+            void* p = ::operator new(32);
+            benchmark::DoNotOptimize(p);
+            ::operator delete(p);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+BENCHMARK(BM_new_delete);
+
+static void BM_small_vector_fill(benchmark::State& state) {
+    for (auto _ : state) {
+        core::small_vector<int, 64> v;
+        for (int i = 0; i < 64; ++i) {
+            v.push_back(i);
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+BENCHMARK(BM_small_vector_fill);
+
+static void BM_ring_buffer_cycle(benchmark::State& state) {
+    core::ring_buffer<int, 1024> rb;
+    int out = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < 1024; ++i) {
+            rb.push(i);
+        }
+        while (rb.pop(out)) {
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+BENCHMARK(BM_ring_buffer_cycle);
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+}
+`, projectName, safeName)
+}
+
+func generateNanoBenchCoreMain(projectName, safeName string) string {
+	return fmt.Sprintf(`#include <nanobench.h>
+#include <%[1]s/core.hpp>
+
+#include "perf_counters.hpp"
+
+namespace core = %[2]s::core;
+
+int main() {
+    ankerl::nanobench::Bench bench;
+
+    // Hardware counters around the allocation-heavy benchmark; nanobench
+    // reports ins/op, cyc/op and IPC natively, the fixture adds branch and
+    // LLC misses.
+    core::arena arena;
+    %[2]s::bench::PerfCounters counters;
+    counters.start();
+    bench.run("arena allocate 32B x1024", [&] {
+        for (int i = 0; i < 1024; ++i) {
+            ankerl::nanobench::doNotOptimizeAway(arena.allocate(32, 16));
+        }
+        arena.reset();
+    });
+    auto counts = counters.stop();
+    std::uint64_t iterations = 0;
+    for (const auto& result : bench.results()) {
+        iterations += static_cast<std::uint64_t>(result.sum(ankerl::nanobench::Result::Measure::iterations));
+    }
+    %[2]s::bench::report("arena allocate 32B x1024", counts, iterations);
+
+    bench.run("operator new/delete 32B x1024", [] {
+        for (int i = 0; i < 1024; ++i) {
+            void* p = ::operator new(32);
+            ankerl::nanobench::doNotOptimizeAway(p);
+            ::operator delete(p);
+        }
+    });
+
+    bench.run("small_vector<int,64> fill", [] {
+        core::small_vector<int, 64> v;
+        for (int i = 0; i < 64; ++i) {
+            v.push_back(i);
+        }
+        ankerl::nanobench::doNotOptimizeAway(v.data());
+    });
+
+    core::ring_buffer<int, 1024> rb;
+    int out = 0;
+    bench.run("ring_buffer<int,1024> cycle", [&] {
+        for (int i = 0; i < 1024; ++i) {
+            rb.push(i);
+        }
+        while (rb.pop(out)) {
+            ankerl::nanobench::doNotOptimizeAway(out);
+        }
+    });
+    return 0;
+}
+`, projectName, safeName)
+}
+
+func generateCatch2BenchCoreMain(projectName, safeName string) string {
+	return fmt.Sprintf(`#include <catch2/catch_all.hpp>
+#include <%[1]s/core.hpp>
+
+#include "perf_counters.hpp"
+
+namespace core = %[2]s::core;
+
+TEST_CASE("Benchmark core", "[benchmark]") {
+    core::arena arena;
+    %[2]s::bench::PerfCounters counters;
+    std::uint64_t iterations = 0;
+
+    counters.start();
+    BENCHMARK("arena allocate 32B x1024") {
+        ++iterations;
+        for (int i = 0; i < 1024; ++i) {
+            (void)arena.allocate(32, 16);
+        }
+        std::size_t used = arena.bytes_used();
+        arena.reset();
+        return used;
+    };
+    %[2]s::bench::report("arena allocate 32B x1024", counters.stop(), iterations);
+
+    BENCHMARK("small_vector<int,64> fill") {
+        core::small_vector<int, 64> v;
+        for (int i = 0; i < 64; ++i) {
+            v.push_back(i);
+        }
+        return v.size();
+    };
+
+    core::ring_buffer<int, 1024> rb;
+    int out = 0;
+    BENCHMARK("ring_buffer<int,1024> cycle") {
+        for (int i = 0; i < 1024; ++i) {
+            rb.push(i);
+        }
+        std::size_t popped = 0;
+        while (rb.pop(out)) {
+            ++popped;
+        }
+        return popped;
+    };
+}
+`, projectName, safeName)
+}
+
+// generateGoogleBenchSimdMain benchmarks the SIMD scaffold: the scalar
+// variant against the runtime-dispatched one for saxpy and dot, with the
+// hardware counters on the dispatched saxpy so IPC shows the vector width
+// paying off.
+func generateGoogleBenchSimdMain(projectName, safeName string) string {
+	return fmt.Sprintf(`#include <benchmark/benchmark.h>
+#include <%[1]s/simd.hpp>
+
+#include "perf_counters.hpp"
+
+#include <vector>
+
+namespace simd = %[2]s::simd;
+
+constexpr std::size_t kN = 1 << 16;
+
+static void BM_saxpy_scalar(benchmark::State& state) {
+    std::vector<float> x(kN, 1.5f);
+    std::vector<float> y(kN, 2.0f);
+    for (auto _ : state) {
+        simd::detail::saxpy_scalar(2.0f, x.data(), y.data(), kN);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * kN * sizeof(float) * 3);
+}
+BENCHMARK(BM_saxpy_scalar);
+
+static void BM_saxpy_simd(benchmark::State& state) {
+    std::vector<float> x(kN, 1.5f);
+    std::vector<float> y(kN, 2.0f);
+    %[2]s::bench::PerfCounters counters;
+    counters.start();
+    for (auto _ : state) {
+        simd::saxpy(2.0f, x.data(), y.data(), kN);
+        benchmark::ClobberMemory();
+    }
+    auto counts = counters.stop();
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * kN * sizeof(float) * 3);
+    state.SetLabel(simd::active_target());
+    if (counts.valid) {
+        using benchmark::Counter;
+        state.counters["cycles"] = Counter(static_cast<double>(counts.cycles), Counter::kAvgIterations);
+        state.counters["instructions"] = Counter(static_cast<double>(counts.instructions), Counter::kAvgIterations);
+        state.counters["IPC"] = Counter(counts.ipc());
+        state.counters["branch-misses"] = Counter(static_cast<double>(counts.branch_misses), Counter::kAvgIterations);
+        state.counters["LLC-misses"] = Counter(static_cast<double>(counts.llc_misses), Counter::kAvgIterations);
+    }
+}
+BENCHMARK(BM_saxpy_simd);
+
+static void BM_dot_scalar(benchmark::State& state) {
+    std::vector<float> x(kN, 1.5f);
+    std::vector<float> y(kN, 2.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(simd::detail::dot_scalar(x.data(), y.data(), kN));
+    }
+}
+BENCHMARK(BM_dot_scalar);
+
+static void BM_dot_simd(benchmark::State& state) {
+    std::vector<float> x(kN, 1.5f);
+    std::vector<float> y(kN, 2.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(simd::dot(x.data(), y.data(), kN));
+    }
+    state.SetLabel(simd::active_target());
+}
+BENCHMARK(BM_dot_simd);
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+}
+`, projectName, safeName)
+}
+
+func generateNanoBenchSimdMain(projectName, safeName string) string {
+	return fmt.Sprintf(`#include <nanobench.h>
+#include <%[1]s/simd.hpp>
+
+#include "perf_counters.hpp"
+
+#include <cstdio>
+#include <vector>
+
+namespace simd = %[2]s::simd;
+
+int main() {
+    constexpr std::size_t n = 1 << 16;
+    std::vector<float> x(n, 1.5f);
+    std::vector<float> y(n, 2.0f);
+
+    std::printf("dispatch selected: %%s\n", simd::active_target());
+
+    ankerl::nanobench::Bench bench;
+
+    bench.run("saxpy scalar", [&] {
+        simd::detail::saxpy_scalar(2.0f, x.data(), y.data(), n);
+        ankerl::nanobench::doNotOptimizeAway(y.data());
+    });
+
+    // Hardware counters around the dispatched path; IPC against the scalar
+    // run shows the vector width paying off
+    %[2]s::bench::PerfCounters counters;
+    counters.start();
+    bench.run("saxpy simd", [&] {
+        simd::saxpy(2.0f, x.data(), y.data(), n);
+        ankerl::nanobench::doNotOptimizeAway(y.data());
+    });
+    auto counts = counters.stop();
+    std::uint64_t iterations = 0;
+    for (const auto& result : bench.results()) {
+        iterations += static_cast<std::uint64_t>(result.sum(ankerl::nanobench::Result::Measure::iterations));
+    }
+    %[2]s::bench::report("saxpy simd", counts, iterations);
+
+    bench.run("dot scalar", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simd::detail::dot_scalar(x.data(), y.data(), n));
+    });
+
+    bench.run("dot simd", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simd::dot(x.data(), y.data(), n));
+    });
+    return 0;
+}
+`, projectName, safeName)
+}
+
+func generateCatch2BenchSimdMain(projectName, safeName string) string {
+	return fmt.Sprintf(`#include <catch2/catch_all.hpp>
+#include <%[1]s/simd.hpp>
+
+#include "perf_counters.hpp"
+
+#include <cstdio>
+#include <vector>
+
+namespace simd = %[2]s::simd;
+
+TEST_CASE("Benchmark simd", "[benchmark]") {
+    constexpr std::size_t n = 1 << 16;
+    std::vector<float> x(n, 1.5f);
+    std::vector<float> y(n, 2.0f);
+
+    std::printf("dispatch selected: %%s\n", simd::active_target());
+
+    BENCHMARK("saxpy scalar") {
+        simd::detail::saxpy_scalar(2.0f, x.data(), y.data(), n);
+        return y[0];
+    };
+
+    %[2]s::bench::PerfCounters counters;
+    std::uint64_t iterations = 0;
+    counters.start();
+    BENCHMARK("saxpy simd") {
+        ++iterations;
+        simd::saxpy(2.0f, x.data(), y.data(), n);
+        return y[0];
+    };
+    %[2]s::bench::report("saxpy simd", counters.stop(), iterations);
+
+    BENCHMARK("dot scalar") {
+        return simd::detail::dot_scalar(x.data(), y.data(), n);
+    };
+
+    BENCHMARK("dot simd") {
+        return simd::dot(x.data(), y.data(), n);
+    };
+}
+`, projectName, safeName)
 }
 
 // SafeIdent converts a project name to a valid C++ identifier
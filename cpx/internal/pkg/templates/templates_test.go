@@ -172,7 +172,7 @@ func TestGenerateBazelrc(t *testing.T) {
 		{
 			name:          "C++17",
 			cppStandard:   17,
-			shouldContain: []string{"c++17", "--symlink_prefix=.", "build:release", "build:debug"},
+			shouldContain: []string{"c++17", "--symlink_prefix=.", "build:release", "build:debug", "build:mold", "build:lld", "build:remote"},
 		},
 		{
 			name:          "C++20",
@@ -239,7 +239,7 @@ func TestGenerateBenchmarkSources(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			sources, deps := GenerateBenchmarkSources(tt.projectName, tt.benchmarkFramework)
+			sources, deps := GenerateBenchmarkSources(tt.projectName, tt.benchmarkFramework, false, false)
 
 			if tt.shouldBeNil {
 				assert.Nil(t, sources)
@@ -250,6 +250,11 @@ func TestGenerateBenchmarkSources(t *testing.T) {
 				assert.Equal(t, tt.expectedDeps, deps)
 				// Verify the benchmark includes the project header
 				assert.Contains(t, sources.Main, tt.projectName)
+				// Verify the perf-counter fixture is scaffolded and used
+				assert.Contains(t, sources.Main, "perf_counters.hpp")
+				assert.Contains(t, sources.PerfHeader, "perf_event_open")
+				assert.Contains(t, sources.PerfHeader, "PERF_COUNT_HW_CPU_CYCLES")
+				assert.Contains(t, sources.PerfHeader, "PERF_COUNT_HW_CACHE_MISSES")
 			}
 		})
 	}
@@ -420,7 +425,7 @@ func TestGenerateMesonBuildSrc(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			result := GenerateMesonBuildSrc(tt.projectName, tt.isExe)
+			result := GenerateMesonBuildSrc(tt.projectName, tt.isExe, false, false)
 
 			for _, s := range tt.shouldContain {
 				assert.Contains(t, result, s, "Expected to contain: %s", s)
@@ -611,6 +616,8 @@ func TestGenerateVcpkgCMakeLists(t *testing.T) {
 				"CMAKE_CXX_STANDARD 17",
 				"add_executable",
 				"add_subdirectory(tests)",
+				"ENABLE_UNITY_BUILD",
+				"CMAKE_UNITY_BUILD",
 			},
 		},
 		{
@@ -629,7 +636,7 @@ func TestGenerateVcpkgCMakeLists(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			result := GenerateVcpkgCMakeLists(tt.projectName, tt.cppStandard, tt.isExe, tt.includeTests, "", false, "0.1.0")
+			result := GenerateVcpkgCMakeLists(tt.projectName, tt.cppStandard, tt.isExe, tt.includeTests, "", false, "0.1.0", false, false)
 
 			for _, s := range tt.shouldContain {
 				assert.Contains(t, result, s, "Expected to contain: %s", s)
@@ -644,6 +651,55 @@ func TestGenerateCMakePresets(t *testing.T) {
 	assert.Contains(t, result, "configurePresets")
 	assert.Contains(t, result, "VCPKG_ROOT")
 	assert.Contains(t, result, "vcpkg.cmake")
+	// Compiler-cache presets
+	assert.Contains(t, result, `"name": "ccache"`)
+	assert.Contains(t, result, `"name": "sccache"`)
+	assert.Contains(t, result, "CMAKE_CXX_COMPILER_LAUNCHER")
+}
+
+func TestGeneratePchHeader(t *testing.T) {
+	tests := []struct {
+		name               string
+		testFramework      string
+		benchmarkFramework string
+		shouldContain      []string
+		shouldNotContain   []string
+	}{
+		{
+			name:             "No frameworks",
+			shouldContain:    []string{"#pragma once", "<vector>", "<string>", "<memory>"},
+			shouldNotContain: []string{"gtest", "benchmark"},
+		},
+		{
+			name:               "GoogleTest with Google Benchmark",
+			testFramework:      "googletest",
+			benchmarkFramework: "google-benchmark",
+			shouldContain:      []string{"<gtest/gtest.h>", "<benchmark/benchmark.h>", "__has_include"},
+		},
+		{
+			name:          "Catch2",
+			testFramework: "catch2",
+			shouldContain: []string{"<catch2/catch_test_macros.hpp>"},
+		},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			result := GeneratePchHeader(tt.testFramework, tt.benchmarkFramework)
+
+			for _, s := range tt.shouldContain {
+				assert.Contains(t, result, s, "Expected to contain: %s", s)
+			}
+			for _, s := range tt.shouldNotContain {
+				assert.NotContains(t, result, s, "Expected NOT to contain: %s", s)
+			}
+		})
+	}
+}
+
+func TestGenerateVcpkgCMakeListsPch(t *testing.T) {
+	result := GenerateVcpkgCMakeLists("myapp", 17, true, false, "", false, "0.1.0", true, false)
+	assert.Contains(t, result, "target_precompile_headers(myapp PRIVATE src/pch.hpp)")
 }
 
 func TestGenerateTestMain(t *testing.T) {
@@ -675,7 +731,7 @@ func TestGenerateTestMain(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			result := GenerateTestMain(tt.projectName, tt.testFramework)
+			result := GenerateTestMain(tt.projectName, tt.testFramework, false)
 
 			for _, s := range tt.shouldContain {
 				assert.Contains(t, result, s, "Expected to contain: %s", s)
@@ -733,3 +789,109 @@ func TestGenerateCpxCI(t *testing.T) {
 	assert.Contains(t, result, "targets:")
 	assert.Contains(t, result, "build:")
 }
+
+func TestGenerateCoreHeader(t *testing.T) {
+	result := GenerateCoreHeader("my-project")
+
+	assert.Contains(t, result, "#ifndef MY_PROJECT_CORE_HPP")
+	assert.Contains(t, result, "namespace my_project::core")
+	assert.Contains(t, result, "class arena")
+	assert.Contains(t, result, "class small_vector")
+	assert.Contains(t, result, "class ring_buffer")
+}
+
+func TestGenerateTestMain_PerfCore(t *testing.T) {
+	for _, framework := range []string{"googletest", "catch2", "doctest", ""} {
+		result := GenerateTestMain("myproject", framework, true)
+		assert.Contains(t, result, "core.hpp", "framework %q", framework)
+		assert.Contains(t, result, "arena", "framework %q", framework)
+		assert.Contains(t, result, "small_vector", "framework %q", framework)
+		assert.Contains(t, result, "ring_buffer", "framework %q", framework)
+	}
+
+	// Without the option the toy tests stay as they were
+	assert.NotContains(t, GenerateTestMain("myproject", "googletest", false), "core.hpp")
+}
+
+func TestGenerateBenchmarkSources_PerfCore(t *testing.T) {
+	for _, framework := range []string{"google-benchmark", "nanobench", "catch2-benchmark"} {
+		sources, _ := GenerateBenchmarkSources("myproject", framework, true, false)
+		assert.NotNil(t, sources)
+		assert.Contains(t, sources.Main, "myproject/core.hpp", "framework %q", framework)
+		assert.Contains(t, sources.Main, "arena", "framework %q", framework)
+		assert.Contains(t, sources.Main, "ring_buffer", "framework %q", framework)
+		// The perf-counter fixture still wraps the allocation-heavy benchmark
+		assert.Contains(t, sources.Main, "perf_counters.hpp", "framework %q", framework)
+	}
+}
+
+func TestGenerateSimdHeader(t *testing.T) {
+	result := GenerateSimdHeader("my-project")
+
+	assert.Contains(t, result, "#ifndef MY_PROJECT_SIMD_HPP")
+	assert.Contains(t, result, "namespace my_project::simd")
+	assert.Contains(t, result, "saxpy")
+	assert.Contains(t, result, "active_target")
+	assert.Contains(t, result, "saxpy_avx2")
+	assert.Contains(t, result, "saxpy_neon")
+}
+
+func TestGenerateSimdKernels(t *testing.T) {
+	result := GenerateSimdKernels("myproject")
+
+	assert.Contains(t, result, "CPX_SIMD_VARIANT")
+	assert.Contains(t, result, "CPX_SIMD_FN(saxpy)")
+	assert.Contains(t, result, "CPX_SIMD_FN(dot)")
+}
+
+func TestGenerateSimdDispatch(t *testing.T) {
+	result := GenerateSimdDispatch("myproject")
+
+	assert.Contains(t, result, "__builtin_cpu_supports")
+	assert.Contains(t, result, "avx512f")
+	assert.Contains(t, result, "saxpy_sse2")
+	assert.Contains(t, result, "saxpy_neon")
+}
+
+func TestGenerateVcpkgCMakeListsSimd(t *testing.T) {
+	result := GenerateVcpkgCMakeLists("myapp", 17, true, false, "", false, "0.1.0", false, true)
+
+	assert.Contains(t, result, "add_simd_variant(scalar)")
+	assert.Contains(t, result, "-mavx2")
+	assert.Contains(t, result, "-mavx512f")
+	assert.Contains(t, result, "src/simd_dispatch.cpp")
+
+	// Without the option the build file is untouched
+	assert.NotContains(t, GenerateVcpkgCMakeLists("myapp", 17, true, false, "", false, "0.1.0", false, false), "add_simd_variant")
+}
+
+func TestGenerateMesonBuildSrcSimd(t *testing.T) {
+	result := GenerateMesonBuildSrc("myapp", true, false, true)
+
+	assert.Contains(t, result, "simd_variants")
+	assert.Contains(t, result, "-mavx2")
+	assert.Contains(t, result, "link_whole : simd_libs")
+}
+
+func TestGenerateBuildBazelSrcSimd(t *testing.T) {
+	result := GenerateBuildBazelSrc("myapp", true, true)
+
+	assert.Contains(t, result, "simd_kernels_avx2")
+	assert.Contains(t, result, "@platforms//cpu:x86_64")
+	assert.Contains(t, result, "\":simd\"")
+}
+
+func TestGenerateBenchmarkSources_Simd(t *testing.T) {
+	for _, framework := range []string{"google-benchmark", "nanobench", "catch2-benchmark"} {
+		sources, _ := GenerateBenchmarkSources("myproject", framework, false, true)
+		assert.NotNil(t, sources)
+		assert.Contains(t, sources.Main, "myproject/simd.hpp", "framework %q", framework)
+		assert.Contains(t, sources.Main, "active_target", "framework %q", framework)
+		assert.Contains(t, sources.Main, "saxpy_scalar", "framework %q", framework)
+		assert.Contains(t, sources.Main, "perf_counters.hpp", "framework %q", framework)
+	}
+
+	// The SIMD benchmark takes precedence when both options are selected
+	sources, _ := GenerateBenchmarkSources("myproject", "google-benchmark", true, true)
+	assert.Contains(t, sources.Main, "simd.hpp")
+}
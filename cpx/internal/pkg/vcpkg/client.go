@@ -25,6 +25,39 @@ func NewClient() (*Client, error) {
 	return &Client{globalConfig: globalConfig}, nil
 }
 
+// DefaultBinaryCacheDir returns the default filesystem backend for vcpkg
+// binary caching when none is configured
+func DefaultBinaryCacheDir() string {
+	homeDir, err := os.UserHomeDir()
+	if err != nil {
+		return ""
+	}
+	return filepath.Join(homeDir, ".cache", "cpx", "vcpkg-binary-cache")
+}
+
+// BinaryCacheDir returns the configured filesystem binary cache directory,
+// falling back to the default location
+func (c *Client) BinaryCacheDir() string {
+	if c.globalConfig.VcpkgBinaryCacheDir != "" {
+		return c.globalConfig.VcpkgBinaryCacheDir
+	}
+	return DefaultBinaryCacheDir()
+}
+
+// binarySources builds the VCPKG_BINARY_SOURCES value: always a filesystem
+// backend so fresh checkouts restore prebuilt dependencies instead of
+// recompiling them, plus the shared HTTP artifact store when configured
+func (c *Client) binarySources() string {
+	sources := []string{"clear", "default,readwrite"}
+	if dir := c.BinaryCacheDir(); dir != "" {
+		sources = append(sources, "files,"+dir+",readwrite")
+	}
+	if url := c.globalConfig.VcpkgBinaryCacheURL; url != "" {
+		sources = append(sources, "http,"+url+",readwrite")
+	}
+	return strings.Join(sources, ";")
+}
+
 // SetupEnv sets VCPKG_ROOT and VCPKG_FEATURE_FLAGS environment variables from cpx config
 // This ensures CMake presets can find vcpkg and uses manifest mode consistently
 func (c *Client) SetupEnv() error {
@@ -54,6 +87,17 @@ func (c *Client) SetupEnv() error {
 		}
 	}
 
+	// Set VCPKG_BINARY_SOURCES if not already set so dependency restores hit
+	// the binary cache instead of rebuilding from source
+	if os.Getenv("VCPKG_BINARY_SOURCES") == "" {
+		if dir := c.BinaryCacheDir(); dir != "" {
+			os.MkdirAll(dir, 0755)
+		}
+		if err := os.Setenv("VCPKG_BINARY_SOURCES", c.binarySources()); err != nil {
+			return fmt.Errorf("failed to set VCPKG_BINARY_SOURCES: %w", err)
+		}
+	}
+
 	if os.Getenv("CPX_DEBUG") != "" {
 		const Cyan = "\033[36m"
 		const Reset = "\033[0m"
@@ -61,6 +105,7 @@ func (c *Client) SetupEnv() error {
 		fmt.Printf("  VCPKG_ROOT=%s\n", os.Getenv("VCPKG_ROOT"))
 		fmt.Printf("  VCPKG_FEATURE_FLAGS=%s\n", os.Getenv("VCPKG_FEATURE_FLAGS"))
 		fmt.Printf("  VCPKG_DISABLE_REGISTRY_UPDATE=%s\n", os.Getenv("VCPKG_DISABLE_REGISTRY_UPDATE"))
+		fmt.Printf("  VCPKG_BINARY_SOURCES=%s\n", os.Getenv("VCPKG_BINARY_SOURCES"))
 	}
 
 	return nil
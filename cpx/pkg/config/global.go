@@ -11,9 +11,11 @@ import (
 
 // GlobalConfig represents the global cpx configuration
 type GlobalConfig struct {
-	VcpkgRoot  string `yaml:"vcpkg_root"`
-	BcrRoot    string `yaml:"bcr_root"`    // Bazel Central Registry path
-	WrapdbRoot string `yaml:"wrapdb_root"` // Meson WrapDB path
+	VcpkgRoot           string `yaml:"vcpkg_root"`
+	BcrRoot             string `yaml:"bcr_root"`                         // Bazel Central Registry path
+	WrapdbRoot          string `yaml:"wrapdb_root"`                      // Meson WrapDB path
+	VcpkgBinaryCacheDir string `yaml:"vcpkg_binary_cache_dir,omitempty"` // filesystem backend for vcpkg binary caching
+	VcpkgBinaryCacheURL string `yaml:"vcpkg_binary_cache_url,omitempty"` // shared HTTP artifact store for vcpkg binaries
 }
 
 // GetConfigDir returns the directory where cpx stores its global config
@@ -207,6 +207,14 @@ configure_vcpkg() {
         printf "%bWarning: Failed to configure cpx automatically.%b\n" "$YELLOW" "$NC"
         printf "Run this manually: %bcpx config set-vcpkg-root %s%b\n" "$CYAN" "$VCPKG_PATH" "$NC"
     fi
+
+    # Set up the vcpkg binary cache so dependency restores reuse prebuilt
+    # binaries instead of recompiling from source. cpx sets
+    # VCPKG_BINARY_SOURCES automatically for every build it drives.
+    VCPKG_BINARY_CACHE_DIR="$HOME/.cache/cpx/vcpkg-binary-cache"
+    mkdir -p "$VCPKG_BINARY_CACHE_DIR" 2>/dev/null || true
+    printf "%bvcpkg binary cache: %s%b\n" "$GREEN" "$VCPKG_BINARY_CACHE_DIR" "$NC"
+    printf "Point it at a shared artifact store with: %bcpx cache set-remote <url>%b\n" "$CYAN" "$NC"
 }
 
 get_latest_version() {